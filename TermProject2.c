@@ -0,0 +1,3890 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <signal.h> 
+#include <sys/msg.h>
+#include <sys/ipc.h>
+#include <sys/errno.h>
+#include <time.h>
+#include <sys/time.h>
+#include <stdarg.h>  // 이 헤더 추가
+#include <limits.h>
+#include <getopt.h>
+#include <string.h>
+#include <strings.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/signalfd.h>
+#include <sys/eventfd.h>
+#endif
+
+#include "trace.h"
+#include "event_log.h"
+
+// 시뮬레이션 규모 기본값 (실행 시 -p/-v/-f 옵션으로 변경)
+// 수천 개 프로세스는 -H 모드에서만: 각 프로세스는 fork 없이 상태(READY/RUNNING/WAITING)와
+// 다음 페이지만 가진 구조체이고, 스케줄러가 실행시킨 틱에 요청 생성기가 그 자리에서 실행됨
+#define DEFAULT_NUM_CHILDREN 10
+#define FORK_MAX_CHILDREN 64    // fork 모드(데모용)에서 만들 수 있는 최대 자식 프로세스 수
+#define PAGE_SIZE 4096    // 4KB
+#define TRUE 1
+#define FALSE 0
+
+#define TIME_QUANTUM 1
+#define DEFAULT_PAGES_PER_PROCESS 10 //프로세스마다의 페이지 수
+#define FRAME_SIZE 4            // 페이지 프레임 크기
+#define DEFAULT_TOTAL_FRAMES 20    // 총 프레임 개수
+
+// 페이지 교체 정책 (policies[] 인덱스)
+#define POLICY_LRU 0            // 이중 연결 리스트 기반 정확한 LRU
+#define POLICY_CLOCK 1          // 참조 비트 기반 CLOCK (second chance)
+#define POLICY_ARC 2            // ghost 리스트로 최근성/빈도 비중을 조절하는 ARC
+#define POLICY_OPT 3            // 미리 알고 있는 요청 순서를 이용하는 Belady OPT
+#define POLICY_AGING 4          // 프레임별 aging 카운터가 가장 작은 프레임을 교체
+#define NUM_POLICIES 5
+
+// 페이지 요청 패턴
+#define WORKLOAD_RANDOM 0       // 매번 임의의 페이지 요청
+#define WORKLOAD_SEQUENTIAL 1   // 0 -> 1 -> ... -> 9 -> 0 순서로 요청
+
+#define CLEAN_FIRST_WINDOW_DIV 4    // -C에서 LRU 끝부터 clean 프레임을 찾을 범위 (전체 프레임의 1/4)
+
+// 프로세스 상태 정의
+#define PROCESS_READY 0
+#define PROCESS_RUNNING 1
+#define PROCESS_WAITING 2
+
+// 기본 시뮬레이션 길이 (틱)
+#define DEFAULT_SIM_TICKS 10000
+#define DEFAULT_TICK_PERIOD_US 1000     // fork 모드의 기본 틱 주기 (마이크로초)
+
+// 로그 버퍼 설정
+#define LOG_BUFFER_SIZE (4 * 1024 * 1024)     // 메모리에 모아두는 로그 최대 크기
+#define LOG_FLUSH_THRESHOLD (1024 * 1024)     // 틱 경계에서 이 크기 이상 쌓였으면 파일로 씀
+#define LOG_FULL_BLOCK 0                      // 버퍼가 가득 차면 바로 파일로 비우고 계속 기록
+#define LOG_FULL_DROP 1                       // 버퍼가 가득 차면 다음 비우기 전까지 로그를 버림
+
+// 표준 출력 추적 레벨 (빌드 시 -DTRACE_LEVEL=n 으로 선택)
+// 틱 루프(시그널 핸들러 안)의 printf는 모두 아래 매크로를 거치므로 TRACE_LEVEL_OFF에서는 코드 자체가 사라짐
+// (꺼진 레벨은 if(0)으로 감싸 인자 타입 검사만 하고 코드는 생성되지 않음)
+#define TRACE_LEVEL_OFF 0       // 출력 없음: 스케줄러/페이징 비용만 측정
+#define TRACE_LEVEL_KERNEL 1    // 틱 번호, 스케줄링 결정, 페이지 히트/폴트/교체
+#define TRACE_LEVEL_VERBOSE 2   // 큐 상태, burst 변화, 큐 이동, 자식 요청까지 (기본)
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL TRACE_LEVEL_VERBOSE
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_KERNEL
+#define TRACE_KERNEL(...) printf(__VA_ARGS__)
+#else
+#define TRACE_KERNEL(...) do { if(0) printf(__VA_ARGS__); } while(0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_VERBOSE
+#define TRACE_VERBOSE(...) printf(__VA_ARGS__)
+#else
+#define TRACE_VERBOSE(...) do { if(0) printf(__VA_ARGS__); } while(0)
+#endif
+
+// 메시지 큐 키 정의
+#define MSG_KEY 12345
+
+// 공유 메모리 링 버퍼 설정
+#define RING_SIZE 64            // 자식 하나당 슬롯 수 (2의 거듭제곱)
+#define CACHE_LINE_SIZE 64
+
+// 페이지 요청 전달 방식
+#define TRANSPORT_RING 0        // 자식별 SPSC 공유 메모리 링 버퍼 (기본)
+#define TRANSPORT_MSG 1         // SysV 메시지 큐
+
+FILE* log_file;
+
+// 시뮬레이션 규모 (옵션 처리 후 init_simulation_arrays()에서 이 크기로 배열을 할당)
+int num_children = DEFAULT_NUM_CHILDREN;
+int pages_per_process = DEFAULT_PAGES_PER_PROCESS;
+int total_pages = DEFAULT_NUM_CHILDREN * DEFAULT_PAGES_PER_PROCESS;
+int total_frames = DEFAULT_TOTAL_FRAMES;
+
+// (프로세스, 페이지) -> page_table 등 평면 배열의 인덱스
+#define PAGE_KEY(proc, page) ((proc) * pages_per_process + (page))
+
+// 캐시 라인 경계에 맞춘, 0으로 채운 연속 배열을 할당하는 함수
+void* alloc_aligned(size_t count, size_t size) {
+    void* ptr;
+    size_t bytes = count * size;
+
+    if(bytes == 0) bytes = 1;
+    if(posix_memalign(&ptr, CACHE_LINE_SIZE, bytes) != 0) {
+        fprintf(stderr, "Failed to allocate %zu bytes\n", bytes);
+        exit(1);
+    }
+    memset(ptr, 0, bytes);
+    return ptr;
+}
+
+// 바이너리 이벤트 로그 (-E): 켜져 있으면 log_* 함수가 텍스트 대신 이벤트 레코드를 기록
+int event_log_enabled = 0;
+const char* event_log_path = NULL;
+FILE* event_file = NULL;
+
+// 페이지 요청을 위한 메시지 구조체
+struct msg_buffer {
+    long msg_type;      // 메시지 타입
+    int process_num;    // 프로세스 번호
+    int page_number; // 요청할 페이지 번호 10개
+    int offset; 
+    int write;          // 1: 쓰기 접근, 0: 읽기 접근
+};
+// 메시지 큐 ID를 저장할 전역 변수
+int msgid;
+
+// 메시지 큐 초기화 함수
+void init_msg_queue() {
+    // 메시지 큐 생성
+    msgid = msgget(MSG_KEY, 0666 | IPC_CREAT);
+    if(msgid == -1) {
+        perror("msgget failed");
+        exit(1);
+    }
+    printf("Message queue initialized with ID: %d\n", msgid);
+}
+
+// 자식 -> 부모 페이지 요청용 단일 생산자/단일 소비자 링 버퍼
+// head는 부모만, tail은 자식만 갱신하며 서로 다른 캐시 라인에 두어 false sharing을 막음
+// 슬롯 형식은 msg_buffer를 그대로 사용하므로 요청 처리/로깅 경로는 메시지 큐와 동일
+struct RequestRing {
+    _Alignas(CACHE_LINE_SIZE) atomic_uint head;    // 부모가 다음에 읽을 위치
+    _Alignas(CACHE_LINE_SIZE) atomic_uint tail;    // 자식이 다음에 쓸 위치
+    _Alignas(CACHE_LINE_SIZE) struct msg_buffer slots[RING_SIZE];
+};
+
+// 요청 전달 방식 (기본: 링 버퍼)
+int transport = TRANSPORT_RING;
+// 자식 수만큼의 링 버퍼 (fork 전에 MAP_SHARED로 만들어 부모/자식이 공유)
+struct RequestRing* request_rings = NULL;
+
+// 링 버퍼 초기화 함수
+void init_request_rings() {
+    request_rings = mmap(NULL, sizeof(struct RequestRing) * num_children,
+                         PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(request_rings == MAP_FAILED) {
+        perror("mmap failed");
+        exit(1);
+    }
+    for(int i = 0; i < num_children; i++) {
+        atomic_init(&request_rings[i].head, 0);
+        atomic_init(&request_rings[i].tail, 0);
+    }
+    printf("Request rings initialized (%d slots per process)\n", RING_SIZE);
+}
+
+// 자식 프로세스 실행 제어 블록 (fork 전에 MAP_SHARED로 만들어 부모/자식이 공유)
+// 부모는 실행시킬 때마다 dispatch_seq를 올리고 깨우며, 자식은 값이 바뀔 때까지 커널에서 잠듦
+struct ChildControl {
+    _Alignas(CACHE_LINE_SIZE) atomic_uint dispatch_seq;   // 실행 요청 횟수 (futex 대기 주소)
+    atomic_int running;                                   // 현재 RUNNING 상태인지 여부
+};
+
+struct ChildControl* child_controls = NULL;
+
+// 실행 제어 블록 초기화 함수
+void init_child_controls() {
+    child_controls = mmap(NULL, sizeof(struct ChildControl) * num_children,
+                          PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(child_controls == MAP_FAILED) {
+        perror("mmap failed");
+        exit(1);
+    }
+    for(int i = 0; i < num_children; i++) {
+        atomic_init(&child_controls[i].dispatch_seq, 0);
+        atomic_init(&child_controls[i].running, 0);
+    }
+}
+
+// *addr가 expected인 동안 잠드는 함수
+// 리눅스는 futex를 사용하고, 그 외 환경에서는 CPU를 양보하며 다시 확인
+void wait_for_change(atomic_uint* addr, unsigned int expected) {
+#ifdef __linux__
+    // 프로세스 간 공유 메모리이므로 FUTEX_PRIVATE_FLAG 없이 사용
+    syscall(SYS_futex, (unsigned int*)addr, FUTEX_WAIT, expected, NULL, NULL, 0);
+#else
+    while(atomic_load_explicit(addr, memory_order_acquire) == expected) {
+        usleep(100);
+    }
+#endif
+}
+
+// addr에서 잠들어 있는 프로세스를 깨우는 함수
+void wake_waiters(atomic_uint* addr) {
+#ifdef __linux__
+    syscall(SYS_futex, (unsigned int*)addr, FUTEX_WAKE, 1, NULL, NULL, 0);
+#else
+    (void)addr;
+#endif
+}
+
+// 자식이 요청 하나를 링에 넣는 함수 (가득 차 있으면 부모가 비울 때까지 양보하며 대기)
+void ring_push(struct RequestRing* ring, const struct msg_buffer* message) {
+    unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    while(tail - atomic_load_explicit(&ring->head, memory_order_acquire) == RING_SIZE) {
+        sched_yield();
+    }
+    ring->slots[tail & (RING_SIZE - 1)] = *message;
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+// 자식이 요청을 보냈음을 부모 이벤트 루프에 알리는 eventfd (fork 전에 생성, -1이면 사용 안 함)
+int request_eventfd = -1;
+
+void notify_parent() {
+#ifdef __linux__
+    if(request_eventfd != -1) {
+        eventfd_write(request_eventfd, 1);
+    }
+#endif
+}
+
+// fork 모드 틱 타이밍 통계 (이벤트 루프에서 갱신)
+struct TickStats {
+    long timer_reads;       // timerfd를 읽은 횟수
+    long overruns;          // 한 번 읽을 때 밀려 있던 추가 만료 수 (버리지 않고 따라잡아 실행)
+    long late_ticks;        // 예정 시각보다 한 주기 이상 늦게 실행된 틱 수
+    long max_lag_us;        // 예정 시각 대비 최대 지연 (마이크로초)
+    long request_wakeups;   // eventfd로 받은 자식 요청 알림 수
+};
+
+struct TickStats tick_stats;
+
+// 전역 통계 변수 추가
+struct Statistics {
+    int total_memory_accesses;
+    int total_page_faults;
+    int total_page_hits;
+    int total_page_replacements;
+    int* page_faults_per_process;     // 프로세스별 폴트 수 [num_children]
+    int* page_hits_per_process;       // 프로세스별 히트 수 [num_children]
+    int process_exits;                // 종료된 프로세스 수 (-X)
+    int released_frames;              // 프로세스 종료로 반납된 프레임 수
+    long cpu_busy_ticks;              // 실행할 프로세스가 있었던 틱 수
+    int total_writes;                 // 쓰기 접근 수
+    int total_write_backs;            // dirty 페이지를 내보내며 backing store에 쓴 수
+    int* write_backs_per_process;     // 내보내진 페이지 주인 기준 write-back 수 [num_children]
+} stats = {0};
+
+
+// 전역 변수로 틱 카운트 추가
+int tick_count = 0;
+// 전역 변수로 상태 플래그 추가
+int is_running = 0;
+// headless 모드: fork/시그널/메시지 큐 없이 한 프로세스 안에서 최대한 빠르게 시뮬레이션
+int headless_mode = 0;
+// 시뮬레이션할 총 틱 수
+int sim_ticks = DEFAULT_SIM_TICKS;
+// 프로세스가 이 횟수만큼 CPU 버스트를 끝내면 종료하고 프레임을 반납한 뒤 새로 시작 (0: 종료 없음)
+int process_lifetime = 0;
+// fork 모드 틱 주기 (마이크로초, 0이면 속도 제한 없이 틱이 끝나는 즉시 다음 틱 실행)
+long tick_period_us = DEFAULT_TICK_PERIOD_US;
+// 틱 실행 구간의 경과 시간 (초, 처리량 보고용)
+double run_elapsed = 0;
+// 사용할 페이지 요청 패턴
+int workload = WORKLOAD_RANDOM;
+// 요청 중 쓰기 접근 비율 (%, 0이면 모두 읽기)
+int write_percent = 0;
+// 교체 시 clean 프레임을 먼저 고름 (-C)
+int clean_first = 0;
+// 현재 처리중인 요청의 요청 순서상 위치 (0부터 시작, 시작 전에는 -1)
+long reference_index = -1;
+
+// 페이지 교체 정책 인터페이스
+// serve_page_request()는 교체 결정을 모두 이 hook들을 통해서만 수행하므로
+// 새 정책은 hook 구현과 policies[] 항목 추가만으로 붙일 수 있음 (NULL인 hook은 호출하지 않음)
+struct ReplacementPolicy {
+    const char* name;                                   // 옵션/로그에 쓰는 이름
+    void (*init)(void);                                 // 시뮬레이션 시작 전 초기화
+    void (*prepare)(const struct TraceRecord* seq, long n);  // 전체 요청 순서를 미리 알 수 있을 때 호출
+    void (*on_hit)(int frame_num);                      // 페이지 히트
+    void (*on_fault)(int key);                          // 페이지 폴트 (프레임 선택 전)
+    int (*choose_victim)(int key);                      // 빈 프레임이 없을 때 교체할 프레임 선택
+    int (*choose_clean_victim)(int key);                // -C: write-back이 없는 clean 프레임을 우선 선택
+    void (*on_evict)(int frame_num);                    // 선택된 프레임에서 페이지를 내보냄
+    void (*on_load)(int frame_num, int key);            // 프레임에 새 페이지 적재
+    void (*on_free)(int frame_num);                     // 프로세스 종료 등으로 프레임이 비워짐
+    void (*report)(FILE* fp);                           // 정책별 최종 통계 출력
+};
+
+// 현재 사용중인 교체 정책
+struct ReplacementPolicy* policy;
+// 트레이스 기록/재생 관련 전역 변수
+struct TraceWriter trace_writer;
+int trace_recording = 0;
+const char* record_path = NULL;
+const char* replay_path = NULL;
+
+// 요청 패턴에 따른 첫 요청 페이지
+int first_page_request() {
+    return (workload == WORKLOAD_SEQUENTIAL) ? 0 : rand() % pages_per_process;
+}
+
+// 자식 프로세스 정보를 담는 구조체
+struct Process {
+   pid_t pid;          // 프로세스 ID
+   int p_num;          // 프로세스 생성 순서 번호 (0,1,2...)
+   int cpu_burst;      // CPU 버스트 시간
+   int wait_burst;     // 대기 시간
+   int state;          // 프로세스 상태
+   int is_running;     // 실행 상태 여부
+   int request_sent;   // 페이지 요청 여부
+   int next_page;      // 다음에 요청할 페이지 번호
+   int bursts_done;    // 현재 실행에서 끝낸 CPU 버스트 수 (-X 종료 판단용)
+   long wake_tick;     // waiting 상태에서 깨어날 틱
+   int io_wait;        // CPU burst가 아니라 page-in 완료를 기다리는 중 (-S)
+   struct Process* wheel_next;  // 타이머 휠 슬롯 내 다음 프로세스
+};
+// 전체 프로세스 관리를 위한 배열
+struct Process* processes;     // [num_children]
+// 프로세스 생성 시 정보를 초기화하는 함수
+void init_process_info(pid_t pid, int p_num) {
+    processes[p_num].pid = pid;
+    processes[p_num].p_num = p_num;
+    // cpu_burst: 3~10 사이의 랜덤 값
+    processes[p_num].cpu_burst = 3 + rand() % 8;  
+    // wait_burst: 3~10 사이의 랜덤 값
+    processes[p_num].wait_burst = 2 + rand() % 4;  // 2 + (0~3) = 2~5 사이의 값
+    processes[p_num].state = PROCESS_READY;
+    processes[p_num].is_running = 0;
+    processes[p_num].request_sent = 0;
+    processes[p_num].next_page = first_page_request();
+}
+
+// 프로세스 원형 큐 (deque)
+// head에서 꺼내고 tail(head + size)에 넣으며, 배열을 밀지 않으므로 모든 연산이 O(1)
+struct ProcessQueue {
+    struct Process** slots;
+    int capacity;   // 슬롯 수
+    int head;       // 맨 앞 원소 위치
+    int size;       // 들어 있는 프로세스 수
+};
+
+void queue_init(struct ProcessQueue* queue, int capacity) {
+    queue->slots = alloc_aligned(capacity, sizeof(struct Process*));
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->size = 0;
+}
+
+// 맨 앞에서 i번째 원소
+struct Process* queue_at(const struct ProcessQueue* queue, int i) {
+    int pos = queue->head + i;
+    if(pos >= queue->capacity) pos -= queue->capacity;
+    return queue->slots[pos];
+}
+
+struct Process* queue_front(const struct ProcessQueue* queue) {
+    return queue->slots[queue->head];
+}
+
+// 맨 뒤에 추가 (가득 차 있으면 0)
+int queue_push_back(struct ProcessQueue* queue, struct Process* process) {
+    if(queue->size == queue->capacity) return 0;
+    int tail = queue->head + queue->size;
+    if(tail >= queue->capacity) tail -= queue->capacity;
+    queue->slots[tail] = process;
+    queue->size++;
+    return 1;
+}
+
+// 맨 앞에서 꺼냄 (비어 있으면 NULL)
+struct Process* queue_pop_front(struct ProcessQueue* queue) {
+    if(queue->size == 0) return NULL;
+    struct Process* process = queue->slots[queue->head];
+    if(++queue->head == queue->capacity) queue->head = 0;
+    queue->size--;
+    return process;
+}
+
+// 맨 앞 원소를 맨 뒤로 보냄 (라운드 로빈)
+void queue_rotate(struct ProcessQueue* queue) {
+    if(queue->size <= 1) return;
+    queue_push_back(queue, queue_pop_front(queue));
+}
+
+// 큐 안의 프로세스를 꺼냄 (맨 앞이면 O(1), 아니면 뒤 원소를 한 칸씩 당김, 없으면 0)
+int queue_remove(struct ProcessQueue* queue, struct Process* process) {
+    if(queue->size == 0) return 0;
+    if(queue_front(queue) == process) {
+        queue_pop_front(queue);
+        return 1;
+    }
+    for(int i = 1; i < queue->size; i++) {
+        if(queue_at(queue, i) != process) continue;
+        for(; i < queue->size - 1; i++) {
+            int pos = queue->head + i;
+            if(pos >= queue->capacity) pos -= queue->capacity;
+            int next = (pos + 1 == queue->capacity) ? 0 : pos + 1;
+            queue->slots[pos] = queue->slots[next];
+        }
+        queue->size--;
+        return 1;
+    }
+    return 0;
+}
+
+// 대기 프로세스용 계층형 타이머 휠
+// 깨어날 틱(wake_tick)을 키로 레벨 0은 1틱, 레벨 1은 64틱, 레벨 2는 4096틱 단위 슬롯에 넣고,
+// 하위 레벨이 한 바퀴 돌 때마다 상위 레벨 슬롯 하나를 아래로 내림(cascade)
+// 매 틱 레벨 0 슬롯 하나만 보므로 비용은 그 틱에 깨어나는 프로세스 수에 비례
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS 3
+#define WHEEL_SPAN (1L << (WHEEL_BITS * WHEEL_LEVELS))   // 휠에 바로 넣을 수 있는 최대 거리 (틱)
+
+struct WheelSlot {
+    struct Process* head;
+    struct Process* tail;   // 같은 틱에 깨어나는 프로세스는 들어온 순서대로 깨움
+};
+
+struct TimerWheel {
+    struct WheelSlot slots[WHEEL_LEVELS][WHEEL_SLOTS];
+    long now;       // 마지막으로 처리한 틱
+    int size;       // 대기 중인 프로세스 수
+};
+
+void wheel_slot_append(struct WheelSlot* slot, struct Process* process) {
+    process->wheel_next = NULL;
+    if(slot->tail != NULL) {
+        slot->tail->wheel_next = process;
+    } else {
+        slot->head = process;
+    }
+    slot->tail = process;
+}
+
+// wake_tick까지의 거리에 맞는 레벨/슬롯에 넣음
+void wheel_place(struct TimerWheel* wheel, struct Process* process) {
+    long expires = process->wake_tick;
+    long delta = expires - wheel->now;
+    int level;
+
+    if(delta < WHEEL_SLOTS) {
+        level = 0;
+        if(delta <= 0) expires = wheel->now;    // 이미 지난 시각: 현재 처리 중인 슬롯에 넣음
+    } else if(delta < (1L << (WHEEL_BITS * 2))) {
+        level = 1;
+    } else {
+        level = 2;
+        if(delta >= WHEEL_SPAN) expires = wheel->now + WHEEL_SPAN - 1;  // 너무 멀면 끝 슬롯에 두고 다시 내려올 때 재배치
+    }
+    wheel_slot_append(&wheel->slots[level][(expires >> (WHEEL_BITS * level)) & WHEEL_MASK], process);
+}
+
+void wheel_insert(struct TimerWheel* wheel, struct Process* process) {
+    wheel_place(wheel, process);
+    wheel->size++;
+}
+
+// 상위 레벨 슬롯 하나를 비우고 현재 시각 기준으로 다시 배치
+void wheel_cascade(struct TimerWheel* wheel, int level, int index) {
+    struct Process* process = wheel->slots[level][index].head;
+
+    wheel->slots[level][index].head = NULL;
+    wheel->slots[level][index].tail = NULL;
+    while(process != NULL) {
+        struct Process* next = process->wheel_next;
+        wheel_place(wheel, process);
+        process = next;
+    }
+}
+
+// running queue 선언
+struct ProcessQueue running_queue;
+// waiting queue: 깨어날 틱 기준 타이머 휠
+struct TimerWheel waiting_queue;
+
+// running queue에 프로세스 추가하는 함수
+void add_to_running_queue(struct Process* process) {
+    if (queue_push_back(&running_queue, process)) {
+        TRACE_VERBOSE("Process %d added to running queue at position %d\n", process->pid, running_queue.size-1);
+    }
+}
+/* ----------------------------------------------------------------------- */
+
+
+// 프로세스의 페이지 정보를 저장할 구조체
+struct Page {
+    int pid;      // 프로세스 ID
+    int pagenum;  // 페이지 번호 (0~9)
+};
+
+//메인 메모리 구현 part 
+// 프레임 구조체 수정
+struct Frame {
+    int is_used;       // 프레임 사용 여부 (0: 미사용, 1: 사용중)
+    struct Page page;  // 가상 메모리에서 가져온 페이지 정보
+    int lru_prev;         // LRU 리스트에서 더 최근에 사용된 프레임 (-1: 없음)
+    int lru_next;         // LRU 리스트에서 덜 최근에 사용된 프레임 (-1: 없음)
+    int referenced;       // CLOCK 정책용 참조 비트 (히트 시 1, 시계 바늘이 지나가면 0)
+    int dirty;            // 적재 후 쓰기 접근이 있었음 (내보낼 때 write-back 필요)
+};
+// 메인 메모리 구조체
+struct PhysicalMemory {
+    struct Frame* frames;                 // 프레임 배열 [total_frames]
+    // 교체 대상을 훑어야 하는 값은 프레임 구조체와 분리해 각자 연속 배열로 둠 (SoA, 캐시 라인 정렬)
+    int* last_access_time;                // 프레임별 마지막 접근 틱 [total_frames]
+    int* age;                             // AGING 정책의 프레임별 카운터 [total_frames]
+    int free_frame_count;                 // 사용 가능한 프레임 수
+    uint64_t* free_map;                   // 빈 프레임 비트맵 (비트 1 = 빈 프레임) [free_map_words]
+    int free_map_words;
+    int free_map_hint;                    // 이 워드보다 앞에는 빈 프레임이 없음
+    int lru_head;                         // 가장 최근에 사용된 프레임 (-1: 리스트 비어있음)
+    int lru_tail;                         // 가장 오래전에 사용된 프레임 = 교체 대상
+    int clock_hand;                       // CLOCK 정책의 시계 바늘 (다음에 검사할 프레임)
+};
+//전역 변수로 메인 메모리 구현
+struct PhysicalMemory pmem;
+
+static int child_p_num;
+
+// 메인 메모리 초기화 함수
+void init_physical_memory() {
+    // 모든 프레임을 미사용 상태로 초기화
+    for(int i = 0; i < total_frames; i++) {
+        pmem.frames[i].is_used = 0;
+        pmem.frames[i].page.pid = -1;
+        pmem.frames[i].page.pagenum = -1;
+        pmem.last_access_time[i] = -1;
+        pmem.age[i] = 0;
+        pmem.frames[i].lru_prev = -1;
+        pmem.frames[i].lru_next = -1;
+        pmem.frames[i].referenced = 0;
+    }
+    pmem.free_frame_count = total_frames;
+    for(int i = 0; i < pmem.free_map_words; i++) {
+        pmem.free_map[i] = ~0ULL;
+    }
+    if(total_frames % 64 != 0) {
+        pmem.free_map[pmem.free_map_words - 1] = (1ULL << (total_frames % 64)) - 1;  // 없는 프레임 비트는 0
+    }
+    pmem.free_map_hint = 0;
+    pmem.lru_head = -1;
+    pmem.lru_tail = -1;
+    pmem.clock_hand = 0;
+    
+    printf("Physical Memory Initialized:\n");
+    printf("Total Frames: %d\n", total_frames);
+    printf("Total Size: %d bytes\n", FRAME_SIZE * total_frames);
+}
+
+// 빈 프레임 할당: 힌트 워드부터 0이 아닌 워드를 찾아 가장 낮은 비트(번호가 가장 작은 빈 프레임)를 꺼냄
+// 64프레임을 한 번에 건너뛰므로 기존 is_used 선형 탐색보다 64배 적게 보고, 빈 프레임이 없으면 -1
+int frame_alloc() {
+    for(int w = pmem.free_map_hint; w < pmem.free_map_words; w++) {
+        uint64_t word = pmem.free_map[w];
+        if(word != 0) {
+            int frame_num = w * 64 + __builtin_ctzll(word);
+            pmem.free_map[w] = word & (word - 1);   // 가장 낮은 1 비트를 지움
+            pmem.free_map_hint = w;
+            pmem.free_frame_count--;
+            pmem.frames[frame_num].is_used = 1;
+            return frame_num;
+        }
+    }
+    return -1;
+}
+
+// 프레임 반납 (O(1)): 정책 자료구조에서 빼고 비트맵에 다시 표시
+void frame_free(int frame_num) {
+    struct Frame* f = &pmem.frames[frame_num];
+    int w = frame_num / 64;
+
+    if(!f->is_used) return;
+    if(policy->on_free != NULL) {
+        policy->on_free(frame_num);
+    }
+    f->is_used = 0;
+    f->page.pid = -1;
+    f->page.pagenum = -1;
+    f->referenced = 0;
+    f->dirty = 0;         // 종료한 프로세스의 페이지이므로 쓰지 않고 버림
+    pmem.free_map[w] |= 1ULL << (frame_num % 64);
+    if(w < pmem.free_map_hint) pmem.free_map_hint = w;
+    pmem.free_frame_count++;
+}
+
+// LRU 리스트 관련 함수들
+// 사용중인 프레임은 모두 pmem.lru_head ~ pmem.lru_tail 이중 연결 리스트에 들어있음
+// head 쪽이 최근 사용, tail 쪽이 가장 오래전 사용이므로 교체 대상은 항상 tail (O(1))
+
+// 프레임을 LRU 리스트에서 떼어내는 함수
+void lru_unlink(int frame_num) {
+    struct Frame* f = &pmem.frames[frame_num];
+
+    if(f->lru_prev != -1) {
+        pmem.frames[f->lru_prev].lru_next = f->lru_next;
+    } else {
+        pmem.lru_head = f->lru_next;
+    }
+    if(f->lru_next != -1) {
+        pmem.frames[f->lru_next].lru_prev = f->lru_prev;
+    } else {
+        pmem.lru_tail = f->lru_prev;
+    }
+    f->lru_prev = -1;
+    f->lru_next = -1;
+}
+
+// 프레임을 LRU 리스트 맨 앞(가장 최근)에 넣는 함수
+void lru_push_front(int frame_num) {
+    struct Frame* f = &pmem.frames[frame_num];
+
+    f->lru_prev = -1;
+    f->lru_next = pmem.lru_head;
+    if(pmem.lru_head != -1) {
+        pmem.frames[pmem.lru_head].lru_prev = frame_num;
+    } else {
+        pmem.lru_tail = frame_num;
+    }
+    pmem.lru_head = frame_num;
+}
+
+// 페이지 히트 시 프레임을 맨 앞으로 옮기는 함수
+void lru_touch(int frame_num) {
+    if(pmem.lru_head == frame_num) return;  // 이미 맨 앞이면 할 일 없음
+    lru_unlink(frame_num);
+    lru_push_front(frame_num);
+}
+
+// 교체할 프레임(가장 오래전에 사용된 프레임)을 반환하는 함수
+int lru_victim(int key) {
+    (void)key;
+    return pmem.lru_tail;
+}
+
+// CFLRU: LRU 끝에서 프레임의 1/4 안에 clean 프레임이 있으면 그것을, 없으면 LRU tail을 교체
+int lru_clean_victim(int key) {
+    int window = total_frames / CLEAN_FIRST_WINDOW_DIV;
+    int frame_num = pmem.lru_tail;
+
+    (void)key;
+    if(window < 1) {
+        window = 1;     // 프레임이 적어도 LRU tail은 검사
+    }
+    for(int i = 0; i < window && frame_num != -1; i++) {
+        if(!pmem.frames[frame_num].dirty) {
+            return frame_num;
+        }
+        frame_num = pmem.frames[frame_num].lru_prev;
+    }
+    return pmem.lru_tail;
+}
+
+void lru_on_hit(int frame_num) {
+    pmem.last_access_time[frame_num] = tick_count;
+    lru_touch(frame_num);
+}
+
+void lru_on_load(int frame_num, int key) {
+    (void)key;
+    lru_push_front(frame_num);
+}
+
+// CLOCK 정책 관련 함수들
+// 히트 시에는 참조 비트만 켜고, 교체 시 시계 바늘이 프레임을 돌며
+// 참조 비트가 켜진 프레임은 비트만 끄고 넘어가고(second chance) 꺼진 프레임을 교체
+
+// 시계 바늘 이동 통계
+struct ClockStatistics {
+    long victim_searches;   // 교체 대상 탐색 횟수
+    long hand_advances;     // 시계 바늘이 이동한 총 칸 수
+    int max_sweep;          // 한 번의 탐색에서 이동한 최대 칸 수
+} clock_stats = {0};
+
+// 교체할 프레임을 찾는 함수 (참조 비트가 꺼진 첫 프레임)
+int clock_victim(int key) {
+    int sweep = 0;
+
+    (void)key;
+    while(pmem.frames[pmem.clock_hand].referenced) {
+        pmem.frames[pmem.clock_hand].referenced = 0;
+        pmem.clock_hand = (pmem.clock_hand + 1) % total_frames;
+        sweep++;
+    }
+    int victim = pmem.clock_hand;
+    pmem.clock_hand = (pmem.clock_hand + 1) % total_frames;
+    sweep++;
+
+    clock_stats.victim_searches++;
+    clock_stats.hand_advances += sweep;
+    if(sweep > clock_stats.max_sweep) {
+        clock_stats.max_sweep = sweep;
+    }
+    return victim;
+}
+
+// enhanced second chance: (참조 0, clean) 프레임을 먼저 한 바퀴 찾고, 없으면 참조 비트를 끄면서
+// (참조 0, dirty) 프레임을 한 바퀴 찾음. 그래도 없으면 참조 비트가 모두 꺼졌으므로 처음부터 다시
+int clock_clean_victim(int key) {
+    int sweep = 0;
+    int victim = -1;
+
+    (void)key;
+    while(victim == -1) {
+        for(int i = 0; i < total_frames && victim == -1; i++) {
+            struct Frame* f = &pmem.frames[pmem.clock_hand];
+            if(!f->referenced && !f->dirty) {
+                victim = pmem.clock_hand;
+            }
+            pmem.clock_hand = (pmem.clock_hand + 1) % total_frames;
+            sweep++;
+        }
+        for(int i = 0; i < total_frames && victim == -1; i++) {
+            struct Frame* f = &pmem.frames[pmem.clock_hand];
+            if(!f->referenced) {
+                victim = pmem.clock_hand;
+            }
+            f->referenced = 0;
+            pmem.clock_hand = (pmem.clock_hand + 1) % total_frames;
+            sweep++;
+        }
+    }
+
+    clock_stats.victim_searches++;
+    clock_stats.hand_advances += sweep;
+    if(sweep > clock_stats.max_sweep) {
+        clock_stats.max_sweep = sweep;
+    }
+    return victim;
+}
+
+// 히트/적재 시에는 참조 비트만 켬
+void clock_on_hit(int frame_num) {
+    pmem.frames[frame_num].referenced = 1;
+}
+
+void clock_on_load(int frame_num, int key) {
+    (void)key;
+    pmem.frames[frame_num].referenced = 1;
+}
+
+void clock_report(FILE* fp) {
+    if(clock_stats.victim_searches == 0) return;
+    fprintf(fp, "\nCLOCK Hand Statistics:\n");
+    fprintf(fp, "Victim Searches: %ld\n", clock_stats.victim_searches);
+    fprintf(fp, "Total Hand Advances: %ld\n", clock_stats.hand_advances);
+    fprintf(fp, "Average Sweep per Fault: %.2f frames\n",
+            (double)clock_stats.hand_advances / clock_stats.victim_searches);
+    fprintf(fp, "Max Sweep: %d frames\n", clock_stats.max_sweep);
+}
+
+// 최솟값 위치 탐색 커널 (교체 대상을 전체 프레임에서 훑어 찾는 정책용)
+// 빌드 시 -mavx2 / -msse4.1 (또는 -march=native)이면 한 번에 8개 / 4개씩 비교하고, 아니면 스칼라
+// 최솟값이 여러 개면 가장 앞의 위치를 반환하므로 세 구현의 결과는 항상 같음
+#if defined(__AVX2__)
+#define MIN_INDEX_KERNEL "AVX2"
+#elif defined(__SSE4_1__)
+#define MIN_INDEX_KERNEL "SSE4.1"
+#else
+#define MIN_INDEX_KERNEL "scalar"
+#endif
+
+int min_index_scalar(const int* values, int start, int n, int best) {
+    for(int i = start; i < n; i++) {
+        if(values[i] < values[best]) best = i;
+    }
+    return best;
+}
+
+// 레인별 (최솟값, 위치)를 모아 가장 작은 값, 같으면 가장 앞의 위치를 고름
+int min_index_reduce(const int* lane_min, const int* lane_idx, int lanes) {
+    int best = 0;
+    for(int i = 1; i < lanes; i++) {
+        if(lane_min[i] < lane_min[best] ||
+           (lane_min[i] == lane_min[best] && lane_idx[i] < lane_idx[best])) {
+            best = i;
+        }
+    }
+    return lane_idx[best];
+}
+
+int min_index(const int* values, int n) {
+#if defined(__AVX2__)
+    if(n >= 8) {
+        __m256i vmin = _mm256_loadu_si256((const __m256i*)values);
+        __m256i vidx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i idx = vidx;
+        const __m256i step = _mm256_set1_epi32(8);
+        int lane_min[8], lane_idx[8];
+        int i;
+
+        for(i = 8; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(values + i));
+            idx = _mm256_add_epi32(idx, step);
+            __m256i less = _mm256_cmpgt_epi32(vmin, v);    // 더 작을 때만 갱신 (같으면 앞의 위치 유지)
+            vmin = _mm256_min_epi32(vmin, v);
+            vidx = _mm256_blendv_epi8(vidx, idx, less);
+        }
+        _mm256_storeu_si256((__m256i*)lane_min, vmin);
+        _mm256_storeu_si256((__m256i*)lane_idx, vidx);
+        return min_index_scalar(values, i, n, min_index_reduce(lane_min, lane_idx, 8));
+    }
+#elif defined(__SSE4_1__)
+    if(n >= 4) {
+        __m128i vmin = _mm_loadu_si128((const __m128i*)values);
+        __m128i vidx = _mm_setr_epi32(0, 1, 2, 3);
+        __m128i idx = vidx;
+        const __m128i step = _mm_set1_epi32(4);
+        int lane_min[4], lane_idx[4];
+        int i;
+
+        for(i = 4; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(values + i));
+            idx = _mm_add_epi32(idx, step);
+            __m128i less = _mm_cmpgt_epi32(vmin, v);
+            vmin = _mm_min_epi32(vmin, v);
+            vidx = _mm_blendv_epi8(vidx, idx, less);
+        }
+        _mm_storeu_si128((__m128i*)lane_min, vmin);
+        _mm_storeu_si128((__m128i*)lane_idx, vidx);
+        return min_index_scalar(values, i, n, min_index_reduce(lane_min, lane_idx, 4));
+    }
+#endif
+    return min_index_scalar(values, 1, n, 0);
+}
+
+// AGING 정책 관련 함수들
+// 프레임마다 8비트 aging 카운터를 두고, 참조되면 카운터 위의 비트(AGING_REF)를 켬.
+// 폴트가 날 때마다 모든 카운터를 오른쪽으로 한 칸 밀어 참조 비트가 최상위 비트로 들어가게 하고,
+// 카운터가 가장 작은(가장 오래 참조되지 않은) 프레임을 min_index()로 찾아 교체
+#define AGING_REF (1 << 8)
+
+// 교체 대상 탐색 통계
+struct AgingStatistics {
+    long victim_scans;      // 전체 프레임을 훑은 횟수
+    long frames_scanned;    // 훑은 프레임 수 합계
+} aging_stats = {0};
+
+void aging_on_hit(int frame_num) {
+    pmem.age[frame_num] |= AGING_REF;
+}
+
+// 참조 비트를 카운터로 밀어 넣음 (SoA 배열이라 컴파일러가 벡터화함)
+void aging_on_fault(int key) {
+    (void)key;
+    for(int i = 0; i < total_frames; i++) {
+        pmem.age[i] >>= 1;
+    }
+}
+
+int aging_victim(int key) {
+    (void)key;
+    aging_stats.victim_scans++;
+    aging_stats.frames_scanned += total_frames;
+    return min_index(pmem.age, total_frames);
+}
+
+// 카운터가 가장 작은 프레임들 중 clean 프레임이 있으면 그것을 교체
+int aging_clean_victim(int key) {
+    int victim = aging_victim(key);
+    int oldest = pmem.age[victim];
+
+    aging_stats.frames_scanned += total_frames;
+    for(int i = 0; i < total_frames; i++) {
+        if(pmem.age[i] == oldest && !pmem.frames[i].dirty) {
+            return i;
+        }
+    }
+    return victim;
+}
+
+void aging_on_load(int frame_num, int key) {
+    (void)key;
+    pmem.age[frame_num] = AGING_REF;
+}
+
+void aging_on_free(int frame_num) {
+    pmem.age[frame_num] = 0;
+}
+
+void aging_report(FILE* fp) {
+    fprintf(fp, "\nAGING Statistics:\n");
+    fprintf(fp, "Min-Index Kernel: %s\n", MIN_INDEX_KERNEL);
+    fprintf(fp, "Victim Scans: %ld (%ld frames)\n", aging_stats.victim_scans, aging_stats.frames_scanned);
+}
+/* ----------------------------------------------------------------------- */
+
+
+// 가상 메모리 생성 영역
+struct VirtualMemory {
+    struct Page* pages;     // [total_pages]
+};
+
+// 전역 변수로 가상 메모리 선언
+struct VirtualMemory virtual_memory;
+// 가상 메모리의 현재 할당 상태를 출력하는 함수
+void print_virtual_memory_status() {
+    printf("\n=== Virtual Memory Status ===\n");
+    for(int i = 0; i < total_pages; i++) {
+        if(virtual_memory.pages[i].pid != -1) {
+            printf("Page[%d]: Process %d, Page number %d\n",
+                   i,
+                   virtual_memory.pages[i].pid,
+                   virtual_memory.pages[i].pagenum);
+        }
+    }
+    printf("==========================\n\n");
+}
+
+int next_available_page = 0;
+
+// 가상 메모리에 프로세스의 페이지 정보를 등록하는 함수
+void register_process_pages(int pid) {
+    // 페이지 공간이 충분한지 확인
+    if (next_available_page + pages_per_process > total_pages) {
+        printf("Error: Not enough pages available in virtual memory\n");
+        return;
+    }
+
+    // 프로세스의 10개 페이지 할당
+    for(int i = 0; i < pages_per_process; i++) {
+        virtual_memory.pages[next_available_page].pid = pid;
+        virtual_memory.pages[next_available_page].pagenum = i;
+        next_available_page++;
+        if(next_available_page == total_pages){
+            print_virtual_memory_status();
+        }
+    }
+
+    // 할당 결과 출력
+    printf("Process %d allocated pages from index %d to %d\n", 
+           pid, 
+           next_available_page - pages_per_process, 
+           next_available_page - 1);
+}
+
+
+// 가상 메모리 초기화 함수
+void init_virtual_memory() {
+    // 모든 페이지 초기화
+    for(int i = 0; i < total_pages; i++) {
+        virtual_memory.pages[i].pid = -1;      // 미할당 상태
+        virtual_memory.pages[i].pagenum = -1;  // 미할당 상태
+    }
+    printf("Virtual Memory Initialized with %d pages\n", total_pages);
+}
+/*--------------------------------------------------------------------------------- */
+// TLB: 페이지 테이블 앞단의 set-associative 주소 변환 캐시 모델
+
+#define DEFAULT_TLB_ENTRIES 16
+#define DEFAULT_TLB_WAYS 4
+#define TLB_REPLACE_LRU 0       // 세트 안에서 가장 오래 사용되지 않은 엔트리 교체
+#define TLB_REPLACE_FIFO 1      // 세트 안에서 가장 먼저 적재된 엔트리 교체
+#define TLB_REPLACE_RANDOM 2    // 세트 안에서 임의의 엔트리 교체
+
+// 사이클 모델 (페이지 폴트 처리 시간은 제외)
+#define TLB_HIT_CYCLES 1            // TLB 조회
+#define PAGE_WALK_CYCLES 100        // TLB 미스 시 메모리에서 페이지 테이블 엔트리 하나를 읽는 비용
+#define MEMORY_ACCESS_CYCLES 100    // 주소 변환 후 실제 데이터 접근
+
+struct TlbEntry {
+    int valid;
+    int asid;       // 주소 공간 식별자 (프로세스 번호)
+    int page;
+    int frame;
+    long stamp;     // LRU: 마지막 사용 시각, FIFO: 적재 시각
+};
+
+struct Tlb {
+    int entries;            // 0이면 TLB 없음 (매 접근마다 페이지 테이블 조회)
+    int ways;               // 세트당 엔트리 수 (entries와 같으면 fully associative)
+    int sets;
+    int replacement;
+    int use_asid;           // 1: ASID 태그로 프로세스를 구분, 0: 프로세스 전환 시 전체 flush
+    int current_asid;       // 마지막으로 실행된 프로세스 (flush 모드)
+    struct TlbEntry* slots; // [sets * ways]
+    long clock;
+    unsigned int rng;       // 임의 교체용 xorshift 상태 (시뮬레이션의 rand() 순서를 바꾸지 않도록 분리)
+    long lookups;
+    long hits;
+    long misses;
+    long flushes;
+    long flushed_entries;
+    long shootdowns;        // 페이지 교체/반납으로 무효화한 엔트리 수
+    long cycles;
+    long walk_cycles;       // cycles 중 TLB 미스로 페이지 테이블을 읽은 비용
+};
+
+struct Tlb tlb = {
+    .entries = DEFAULT_TLB_ENTRIES,
+    .ways = DEFAULT_TLB_WAYS,
+    .replacement = TLB_REPLACE_LRU,
+    .use_asid = 1,
+    .current_asid = -1,
+    .rng = 2463534242u,
+};
+
+const char* tlb_replacement_names[] = { "lru", "fifo", "random" };
+
+// -b entries[,ways[,lru|fifo|random[,asid|flush]]] 옵션을 해석하는 함수 (ways 0 = fully associative)
+int parse_tlb_spec(const char* spec) {
+    char buf[64];
+    char* save = NULL;
+    char* field;
+
+    snprintf(buf, sizeof(buf), "%s", spec);
+    field = strtok_r(buf, ",", &save);
+    if(field == NULL || (tlb.entries = atoi(field)) < 0) {
+        return -1;
+    }
+    if((field = strtok_r(NULL, ",", &save)) != NULL) {
+        tlb.ways = atoi(field);
+        if(tlb.ways < 0) {
+            return -1;
+        }
+    }
+    if(tlb.ways == 0 || tlb.ways > tlb.entries) {
+        tlb.ways = tlb.entries;
+    }
+    if(tlb.entries > 0 && tlb.entries % tlb.ways != 0) {
+        return -1;
+    }
+    if((field = strtok_r(NULL, ",", &save)) != NULL) {
+        int found = 0;
+        for(int i = 0; i < 3; i++) {
+            if(strcmp(field, tlb_replacement_names[i]) == 0) {
+                tlb.replacement = i;
+                found = 1;
+            }
+        }
+        if(!found) {
+            return -1;
+        }
+    }
+    if((field = strtok_r(NULL, ",", &save)) != NULL) {
+        if(strcmp(field, "asid") == 0) {
+            tlb.use_asid = 1;
+        } else if(strcmp(field, "flush") == 0) {
+            tlb.use_asid = 0;
+        } else {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void init_tlb() {
+    if(tlb.entries == 0) {
+        return;
+    }
+    tlb.sets = tlb.entries / tlb.ways;
+    tlb.slots = alloc_aligned(tlb.entries, sizeof(struct TlbEntry));
+}
+
+struct TlbEntry* tlb_set(int asid, int page) {
+    return &tlb.slots[(PAGE_KEY(asid, page) % tlb.sets) * tlb.ways];
+}
+
+// 프레임 번호를 찾으면 반환, TLB 미스면 -1 (호출한 쪽이 페이지 테이블을 조회하고 그 비용을 더함)
+int tlb_lookup(int asid, int page) {
+    tlb.lookups++;
+    tlb.cycles += MEMORY_ACCESS_CYCLES;
+    if(tlb.entries == 0) {
+        tlb.misses++;
+        return -1;
+    }
+
+    tlb.clock++;
+    tlb.cycles += TLB_HIT_CYCLES;
+    struct TlbEntry* set = tlb_set(asid, page);
+    for(int i = 0; i < tlb.ways; i++) {
+        if(set[i].valid && set[i].asid == asid && set[i].page == page) {
+            tlb.hits++;
+            if(tlb.replacement == TLB_REPLACE_LRU) {
+                set[i].stamp = tlb.clock;
+            }
+            return set[i].frame;
+        }
+    }
+    tlb.misses++;
+    return -1;
+}
+
+// 페이지 테이블 조회 결과를 TLB에 적재하는 함수
+void tlb_insert(int asid, int page, int frame) {
+    if(tlb.entries == 0) {
+        return;
+    }
+
+    struct TlbEntry* set = tlb_set(asid, page);
+    int victim = -1;
+    for(int i = 0; i < tlb.ways; i++) {
+        if(!set[i].valid) {
+            victim = i;
+            break;
+        }
+    }
+    if(victim == -1) {
+        if(tlb.replacement == TLB_REPLACE_RANDOM) {
+            tlb.rng ^= tlb.rng << 13;
+            tlb.rng ^= tlb.rng >> 17;
+            tlb.rng ^= tlb.rng << 5;
+            victim = tlb.rng % tlb.ways;
+        } else {
+            victim = 0;
+            for(int i = 1; i < tlb.ways; i++) {
+                if(set[i].stamp < set[victim].stamp) {
+                    victim = i;
+                }
+            }
+        }
+    }
+
+    set[victim].valid = 1;
+    set[victim].asid = asid;
+    set[victim].page = page;
+    set[victim].frame = frame;
+    set[victim].stamp = tlb.clock;
+}
+
+// 페이지가 프레임에서 내려갈 때 해당 변환을 지우는 함수 (TLB shootdown)
+void tlb_invalidate(int asid, int page) {
+    if(tlb.entries == 0) {
+        return;
+    }
+
+    struct TlbEntry* set = tlb_set(asid, page);
+    for(int i = 0; i < tlb.ways; i++) {
+        if(set[i].valid && set[i].asid == asid && set[i].page == page) {
+            set[i].valid = 0;
+            tlb.shootdowns++;
+            return;
+        }
+    }
+}
+
+void tlb_flush() {
+    for(int i = 0; i < tlb.entries; i++) {
+        if(tlb.slots[i].valid) {
+            tlb.slots[i].valid = 0;
+            tlb.flushed_entries++;
+        }
+    }
+    tlb.flushes++;
+}
+
+// 프로세스 전환 시 호출: ASID 모드면 그대로 두고, 아니면 다른 프로세스로 바뀔 때 전체 flush
+void tlb_switch(int asid) {
+    if(tlb.entries == 0 || tlb.use_asid) {
+        return;
+    }
+    if(tlb.current_asid != -1 && tlb.current_asid != asid) {
+        tlb_flush();
+    }
+    tlb.current_asid = asid;
+}
+
+void tlb_report(FILE* fp) {
+    if(tlb.entries == 0) {
+        fprintf(fp, "\nTLB Statistics (disabled):\n");
+    } else {
+        fprintf(fp, "\nTLB Statistics (%d entries, %d-way, %s, %s):\n", tlb.entries, tlb.ways,
+                tlb_replacement_names[tlb.replacement],
+                tlb.use_asid ? "ASID tagged" : "flush on switch");
+    }
+    fprintf(fp, "TLB Lookups: %ld\n", tlb.lookups);
+    fprintf(fp, "TLB Hits: %ld\n", tlb.hits);
+    fprintf(fp, "TLB Misses: %ld\n", tlb.misses);
+    if(tlb.lookups > 0) {
+        fprintf(fp, "TLB Hit Rate: %.2f%%\n", (float)tlb.hits / tlb.lookups * 100);
+        fprintf(fp, "TLB Miss Rate: %.2f%%\n", (float)tlb.misses / tlb.lookups * 100);
+    }
+    if(!tlb.use_asid) {
+        fprintf(fp, "TLB Flushes: %ld (%ld entries)\n", tlb.flushes, tlb.flushed_entries);
+    }
+    fprintf(fp, "TLB Shootdowns: %ld\n", tlb.shootdowns);
+
+    // TLB 없이 매 접근마다 페이지 테이블을 읽었을 때와 비교 (조회 비용은 미스 때의 평균으로 추정)
+    long walk_only = tlb.lookups * MEMORY_ACCESS_CYCLES;
+    if(tlb.misses > 0) {
+        walk_only += (long)((double)tlb.walk_cycles / tlb.misses * tlb.lookups);
+    }
+    fprintf(fp, "Modeled Cycles: %ld (TLB %d, memory %d per access, walk %d per table entry read)\n",
+            tlb.cycles, TLB_HIT_CYCLES, MEMORY_ACCESS_CYCLES, PAGE_WALK_CYCLES);
+    if(tlb.lookups > 0) {
+        fprintf(fp, "Average Cycles per Access: %.2f\n", (double)tlb.cycles / tlb.lookups);
+        fprintf(fp, "Cycles without TLB: %ld (%.2fx)\n", walk_only, (double)walk_only / tlb.cycles);
+    }
+}
+/*--------------------------------------------------------------------------------- */
+
+
+// 페이지 테이블 엔트리 구조체
+struct PageTable {
+    int frame_number;        // 매핑된 물리 메모리 프레임 번호
+    int valid;              // 페이지가 물리 메모리에 있는지 여부 (0: invalid, 1: valid)
+    int virtual_page_index; // 가상 메모리에서의 페이지 인덱스
+};
+
+// 페이지 테이블 백엔드 (-g 옵션)
+#define PT_DENSE 0              // 프로세스마다 VPN 개수만큼의 평면 배열
+#define PT_RADIX2 1             // 2단계 radix 트리 (필요한 노드만 할당)
+#define PT_RADIX4 2             // 4단계 radix 트리 (48비트 주소면 x86-64처럼 단계당 9비트)
+#define PT_HASHED 3             // 프레임 수 크기의 해시 역 페이지 테이블
+#define NUM_PAGE_TABLES 4
+
+#define OFFSET_BITS 12                  // PAGE_SIZE = 4KB
+#define MAX_ADDRESS_BITS 48
+#define DENSE_MAX_ENTRIES (1L << 26)    // dense 백엔드가 할당할 수 있는 최대 엔트리 수
+#define VPN_REGION_BITS 6                   // -A에서 연속으로 두는 페이지 묶음 크기 (64페이지 = 256KB)
+#define VPN_SCATTER 0x9E3779B97F4A7C15ULL   // 페이지 묶음을 주소 공간에 흩는 홀수 곱수
+#define RADIX_MAX_NODE_BITS 16              // radix 노드 하나의 최대 엔트리 수 (2^16)
+#define IPT_PID_MIX 0xC2B2AE3D27D4EB4FULL   // 역 페이지 테이블 해시에 프로세스 번호를 섞는 곱수
+
+// 0이면 프로세스의 페이지 i를 VPN i에 둠, 아니면 이 비트 수의 주소 공간 전체에 흩어 둠 (-A)
+int address_bits = 0;
+int vpn_bits;                   // VPN 비트 수
+uint64_t vpn_span;              // 프로세스당 VPN 개수
+
+struct PageTableBackend {
+    const char* name;
+    int levels;                                                     // radix 단계 수
+    void (*init)(void);
+    int (*lookup)(int p_num, uint64_t vpn, int* refs);             // 프레임 번호 또는 -1, refs에 읽은 엔트리 수를 더함
+    void (*map)(int p_num, uint64_t vpn, int frame_num, int key);
+    void (*unmap)(int p_num, uint64_t vpn);
+    void (*report)(FILE* fp);
+};
+
+struct PageTableBackend* page_table_backend;
+
+struct PageTableStatistics {
+    long walks;             // TLB 미스로 인한 페이지 테이블 조회 수
+    long memory_refs;       // 조회 중 읽은 페이지 테이블 엔트리 수
+    int max_refs;
+    size_t bytes;           // 백엔드가 할당한 메모리
+};
+
+struct PageTableStatistics pt_stats;
+
+// 프로세스의 페이지 번호를 VPN으로 바꾸는 함수
+// 페이지를 64개씩 묶어 묶음 안에서는 연속으로, 묶음끼리는 주소 공간에 흩어 둠
+// (곱수가 홀수이므로 한 프로세스 안에서 묶음의 위치가 겹치지 않음)
+uint64_t page_vpn(int p_num, int page_num) {
+    if(address_bits == 0) {
+        return page_num;
+    }
+    int region_bits = vpn_bits < VPN_REGION_BITS ? vpn_bits : VPN_REGION_BITS;
+    uint64_t region = (uint64_t)page_num >> region_bits;
+    uint64_t base = (region * VPN_SCATTER + (uint64_t)p_num) << region_bits;
+    return (base | (page_num & ((1 << region_bits) - 1))) & (vpn_span - 1);
+}
+
+void* page_table_alloc(size_t count, size_t size) {
+    pt_stats.bytes += count * size;
+    return alloc_aligned(count, size);
+}
+
+// dense: 전체 프로세스의 페이지 테이블 엔트리들을 관리하는 평면 배열
+// [프로세스 인덱스 * vpn_span + VPN] (기본 배치에서는 PAGE_KEY와 같음)
+struct PageTable* page_table;
+
+void dense_init() {
+    uint64_t entries = (uint64_t)num_children * vpn_span;
+    if(entries > DENSE_MAX_ENTRIES) {
+        fprintf(stderr, "dense page table needs %llu entries (%llu MB) for a %d-bit address space: use -g radix4 or -g hashed\n",
+                (unsigned long long)entries,
+                (unsigned long long)(entries * sizeof(struct PageTable) >> 20), address_bits);
+        exit(1);
+    }
+    page_table = page_table_alloc(entries, sizeof(struct PageTable));
+    for(uint64_t i = 0; i < entries; i++) {
+        page_table[i].frame_number = -1;    // 아직 물리 메모리에 할당되지 않음
+        page_table[i].valid = 0;            // invalid 상태
+        page_table[i].virtual_page_index = -1;
+    }
+    for(int i = 0; i < num_children; i++) {
+        for(int j = 0; j < pages_per_process; j++) {
+            // 가상 메모리 인덱스 계산: (프로세스 번호 * 페이지 개수) + 페이지 번호
+            page_table[i * vpn_span + page_vpn(i, j)].virtual_page_index = PAGE_KEY(i, j);
+        }
+    }
+}
+
+int dense_lookup(int p_num, uint64_t vpn, int* refs) {
+    struct PageTable* pte = &page_table[p_num * vpn_span + vpn];
+    (*refs)++;
+    return pte->valid ? pte->frame_number : -1;
+}
+
+void dense_map(int p_num, uint64_t vpn, int frame_num, int key) {
+    struct PageTable* pte = &page_table[p_num * vpn_span + vpn];
+    (void)key;
+    pte->frame_number = frame_num;
+    pte->valid = 1;
+}
+
+void dense_unmap(int p_num, uint64_t vpn) {
+    struct PageTable* pte = &page_table[p_num * vpn_span + vpn];
+    pte->frame_number = -1;
+    pte->valid = 0;
+}
+
+// radix: 프로세스별 루트에서 VPN 비트를 단계별로 잘라 내려가는 트리
+// 중간 노드는 다음 노드 포인터 배열, 마지막 단계는 페이지 테이블 엔트리 배열이며 처음 매핑될 때 할당
+struct RadixTable {
+    void** roots;           // [num_children]
+    int bits_per_level;
+    int fanout;
+    long nodes;
+};
+
+struct RadixTable radix;
+
+void radix_init() {
+    int levels = page_table_backend->levels;
+    radix.bits_per_level = (vpn_bits + levels - 1) / levels;
+    if(radix.bits_per_level > RADIX_MAX_NODE_BITS) {
+        fprintf(stderr, "%s needs %d-bit nodes for a %d-bit address space: use -g radix4 or -g hashed\n",
+                page_table_backend->name, radix.bits_per_level, address_bits);
+        exit(1);
+    }
+    radix.fanout = 1 << radix.bits_per_level;
+    radix.roots = page_table_alloc(num_children, sizeof(void*));
+}
+
+// VPN에 해당하는 마지막 단계 엔트리를 찾는 함수 (create면 없는 노드를 만듦)
+// 루트 포인터는 레지스터(CR3)에 있다고 보고, 단계마다 노드 엔트리 하나를 읽은 것으로 셈
+struct PageTable* radix_walk(int p_num, uint64_t vpn, int create, int* refs) {
+    int levels = page_table_backend->levels;
+    void** slot = &radix.roots[p_num];
+
+    for(int level = 0; level < levels; level++) {
+        int last = (level == levels - 1);
+        if(*slot == NULL) {
+            if(!create) {
+                return NULL;
+            }
+            *slot = page_table_alloc(radix.fanout, last ? sizeof(struct PageTable) : sizeof(void*));
+            radix.nodes++;
+        }
+        (*refs)++;
+        int index = (vpn >> ((levels - 1 - level) * radix.bits_per_level)) & (radix.fanout - 1);
+        if(last) {
+            return &((struct PageTable*)*slot)[index];
+        }
+        slot = &((void**)*slot)[index];
+    }
+    return NULL;
+}
+
+int radix_lookup(int p_num, uint64_t vpn, int* refs) {
+    struct PageTable* pte = radix_walk(p_num, vpn, 0, refs);
+    return (pte != NULL && pte->valid) ? pte->frame_number : -1;
+}
+
+void radix_map(int p_num, uint64_t vpn, int frame_num, int key) {
+    int refs = 0;
+    struct PageTable* pte = radix_walk(p_num, vpn, 1, &refs);
+    pte->frame_number = frame_num;
+    pte->valid = 1;
+    pte->virtual_page_index = key;
+}
+
+void radix_unmap(int p_num, uint64_t vpn) {
+    int refs = 0;
+    struct PageTable* pte = radix_walk(p_num, vpn, 0, &refs);
+    if(pte != NULL) {
+        pte->frame_number = -1;
+        pte->valid = 0;
+    }
+}
+
+void radix_report(FILE* fp) {
+    fprintf(fp, "Radix Nodes: %ld (%d levels, %d entries per node)\n",
+            radix.nodes, page_table_backend->levels, radix.fanout);
+}
+
+// hashed: 물리 프레임마다 엔트리 하나를 두는 역 페이지 테이블
+// (프로세스, VPN) 해시로 앵커 테이블에서 체인의 첫 프레임을 찾고 체인을 따라가며 비교
+struct InvertedEntry {
+    uint64_t vpn;
+    int p_num;              // -1이면 빈 프레임
+    int next;               // 같은 해시 체인의 다음 프레임 (-1: 끝)
+};
+
+struct InvertedTable {
+    struct InvertedEntry* entries;  // [total_frames], 인덱스가 곧 프레임 번호
+    int* anchors;                   // [해시 크기] 체인의 첫 프레임
+    unsigned int mask;
+    int max_chain;
+};
+
+struct InvertedTable ipt;
+
+unsigned int ipt_hash(int p_num, uint64_t vpn) {
+    uint64_t h = (vpn ^ ((uint64_t)p_num * IPT_PID_MIX)) * VPN_SCATTER;
+    return (unsigned int)(h >> 32) & ipt.mask;
+}
+
+void hashed_init() {
+    unsigned int size = 1;
+    while(size < (unsigned int)total_frames) {
+        size <<= 1;
+    }
+    ipt.mask = size - 1;
+    ipt.anchors = page_table_alloc(size, sizeof(int));
+    ipt.entries = page_table_alloc(total_frames, sizeof(struct InvertedEntry));
+    for(unsigned int i = 0; i < size; i++) {
+        ipt.anchors[i] = -1;
+    }
+    for(int i = 0; i < total_frames; i++) {
+        ipt.entries[i].p_num = -1;
+        ipt.entries[i].next = -1;
+    }
+}
+
+int hashed_lookup(int p_num, uint64_t vpn, int* refs) {
+    int frame_num = ipt.anchors[ipt_hash(p_num, vpn)];
+    int chain = 0;
+
+    (*refs)++;     // 앵커 테이블
+    while(frame_num != -1) {
+        (*refs)++;
+        chain++;
+        if(ipt.entries[frame_num].p_num == p_num && ipt.entries[frame_num].vpn == vpn) {
+            break;
+        }
+        frame_num = ipt.entries[frame_num].next;
+    }
+    if(chain > ipt.max_chain) {
+        ipt.max_chain = chain;
+    }
+    return frame_num;
+}
+
+void hashed_map(int p_num, uint64_t vpn, int frame_num, int key) {
+    unsigned int h = ipt_hash(p_num, vpn);
+    (void)key;
+    ipt.entries[frame_num].p_num = p_num;
+    ipt.entries[frame_num].vpn = vpn;
+    ipt.entries[frame_num].next = ipt.anchors[h];
+    ipt.anchors[h] = frame_num;
+}
+
+void hashed_unmap(int p_num, uint64_t vpn) {
+    int* link = &ipt.anchors[ipt_hash(p_num, vpn)];
+    while(*link != -1) {
+        struct InvertedEntry* entry = &ipt.entries[*link];
+        if(entry->p_num == p_num && entry->vpn == vpn) {
+            *link = entry->next;
+            entry->p_num = -1;
+            entry->next = -1;
+            return;
+        }
+        link = &entry->next;
+    }
+}
+
+void hashed_report(FILE* fp) {
+    fprintf(fp, "Hash Anchors: %u, Longest Chain Walked: %d\n", ipt.mask + 1, ipt.max_chain);
+}
+
+struct PageTableBackend page_tables[NUM_PAGE_TABLES] = {
+    [PT_DENSE] = {
+        .name = "dense",
+        .init = dense_init,
+        .lookup = dense_lookup,
+        .map = dense_map,
+        .unmap = dense_unmap,
+    },
+    [PT_RADIX2] = {
+        .name = "radix2",
+        .levels = 2,
+        .init = radix_init,
+        .lookup = radix_lookup,
+        .map = radix_map,
+        .unmap = radix_unmap,
+        .report = radix_report,
+    },
+    [PT_RADIX4] = {
+        .name = "radix4",
+        .levels = 4,
+        .init = radix_init,
+        .lookup = radix_lookup,
+        .map = radix_map,
+        .unmap = radix_unmap,
+        .report = radix_report,
+    },
+    [PT_HASHED] = {
+        .name = "hashed",
+        .init = hashed_init,
+        .lookup = hashed_lookup,
+        .map = hashed_map,
+        .unmap = hashed_unmap,
+        .report = hashed_report,
+    },
+};
+
+// 이름으로 페이지 테이블 백엔드를 찾는 함수 (-g 옵션)
+struct PageTableBackend* find_page_table(const char* name) {
+    for(int i = 0; i < NUM_PAGE_TABLES; i++) {
+        if(strcmp(name, page_tables[i].name) == 0) {
+            return &page_tables[i];
+        }
+    }
+    return NULL;
+}
+
+void init_page_table() {
+    if(address_bits == 0) {
+        vpn_span = pages_per_process;
+        vpn_bits = 1;
+        while((1ULL << vpn_bits) < vpn_span) {
+            vpn_bits++;
+        }
+    } else {
+        vpn_bits = address_bits - OFFSET_BITS;
+        vpn_span = 1ULL << vpn_bits;
+    }
+    page_table_backend->init();
+    printf("Page Table Initialized\n");
+}
+
+// TLB 미스 시 페이지 테이블을 조회하는 함수: 읽은 엔트리 수만큼 조회 비용을 셈
+int page_table_walk(int p_num, int page_num) {
+    int refs = 0;
+    int frame_num = page_table_backend->lookup(p_num, page_vpn(p_num, page_num), &refs);
+
+    pt_stats.walks++;
+    pt_stats.memory_refs += refs;
+    if(refs > pt_stats.max_refs) {
+        pt_stats.max_refs = refs;
+    }
+    tlb.cycles += (long)refs * PAGE_WALK_CYCLES;
+    tlb.walk_cycles += (long)refs * PAGE_WALK_CYCLES;
+    return frame_num;
+}
+
+// 커널 내부용 조회 (교체 정책, 프로세스 종료): 조회 비용에 넣지 않음
+int page_table_find(int p_num, int page_num) {
+    int refs = 0;
+    return page_table_backend->lookup(p_num, page_vpn(p_num, page_num), &refs);
+}
+
+void page_table_map(int p_num, int page_num, int frame_num) {
+    page_table_backend->map(p_num, page_vpn(p_num, page_num), frame_num, PAGE_KEY(p_num, page_num));
+}
+
+void page_table_unmap(int p_num, int page_num) {
+    page_table_backend->unmap(p_num, page_vpn(p_num, page_num));
+}
+
+void page_table_report(FILE* fp) {
+    size_t dense_bytes = (size_t)num_children * vpn_span * sizeof(struct PageTable);
+
+    if(address_bits == 0) {
+        fprintf(fp, "\nPage Table Statistics (%s, %d pages per process):\n",
+                page_table_backend->name, pages_per_process);
+    } else {
+        fprintf(fp, "\nPage Table Statistics (%s, %d-bit address space):\n",
+                page_table_backend->name, address_bits);
+    }
+    fprintf(fp, "Page Table Memory: %zu bytes (dense equivalent %zu bytes)\n", pt_stats.bytes, dense_bytes);
+    fprintf(fp, "Page Table Walks: %ld\n", pt_stats.walks);
+    if(pt_stats.walks > 0) {
+        fprintf(fp, "Entries Read per Walk: %.2f (max %d)\n",
+                (double)pt_stats.memory_refs / pt_stats.walks, pt_stats.max_refs);
+    }
+    if(page_table_backend->report != NULL) {
+        page_table_backend->report(fp);
+    }
+}
+
+// 프로세스가 가진 프레임을 모두 반납하고 페이지 테이블을 비우는 함수 (프로세스 종료 시)
+// 해당 프로세스의 페이지만 보므로 전체 프레임 수와 무관
+int release_process_frames(int p_num) {
+    int released = 0;
+
+    for(int i = 0; i < pages_per_process; i++) {
+        int frame_num = page_table_find(p_num, i);
+        if(frame_num != -1) {
+            tlb_invalidate(p_num, i);
+            frame_free(frame_num);
+            page_table_unmap(p_num, i);
+            released++;
+        }
+    }
+    return released;
+}
+/*--------------------------------------------------------------------------------- */
+
+// Backing store(스왑 장치) 지연 모델 (-S)
+// I/O는 queue_depth개의 채널 중 가장 먼저 비는 채널에서 도착 순서대로 처리되며,
+// 채널이 모두 바쁘면 비는 틱까지 큐에서 기다림
+
+#define DEFAULT_SWAP_WRITE_LATENCY 0    // 0이면 읽기 지연과 같음
+#define DEFAULT_SWAP_QUEUE_DEPTH 1
+
+struct SwapDevice {
+    int enabled;
+    int read_latency;       // page-in 한 번에 걸리는 틱
+    int write_latency;      // write-back 한 번에 걸리는 틱
+    int queue_depth;        // 동시에 처리할 수 있는 I/O 수
+    long* channel_free;     // 채널별로 다음 I/O를 시작할 수 있는 틱 [queue_depth]
+    long reads;
+    long writes;
+    long busy_ticks;        // 채널들이 I/O를 처리한 틱 합계
+    long queue_delay;       // I/O가 채널을 기다린 틱 합계
+    long max_queue_delay;
+    long service_ticks;     // 폴트마다 요청부터 page-in 완료까지 걸린 틱 합계
+    long blocked;           // page-in 완료를 기다리며 waiting queue로 간 횟수
+};
+
+struct SwapDevice swap_device = {
+    .write_latency = DEFAULT_SWAP_WRITE_LATENCY,
+    .queue_depth = DEFAULT_SWAP_QUEUE_DEPTH,
+};
+
+// -S read[,write[,depth]] 옵션을 해석하는 함수 (단위: 틱)
+int parse_swap_spec(const char* spec) {
+    char buf[64];
+    char* save = NULL;
+    char* field;
+
+    snprintf(buf, sizeof(buf), "%s", spec);
+    field = strtok_r(buf, ",", &save);
+    if(field == NULL || (swap_device.read_latency = atoi(field)) <= 0) {
+        return -1;
+    }
+    if((field = strtok_r(NULL, ",", &save)) != NULL) {
+        if((swap_device.write_latency = atoi(field)) < 0) {
+            return -1;
+        }
+    }
+    if((field = strtok_r(NULL, ",", &save)) != NULL) {
+        if((swap_device.queue_depth = atoi(field)) <= 0) {
+            return -1;
+        }
+    }
+    if(swap_device.write_latency == 0) {
+        swap_device.write_latency = swap_device.read_latency;
+    }
+    swap_device.enabled = 1;
+    return 0;
+}
+
+void init_swap_device() {
+    if(!swap_device.enabled) {
+        return;
+    }
+    swap_device.channel_free = alloc_aligned(swap_device.queue_depth, sizeof(long));
+}
+
+// ready 틱부터 시작할 수 있는 I/O 하나를 가장 먼저 비는 채널에 넣고 완료 틱을 반환
+long swap_submit(long ready, int latency) {
+    int channel = 0;
+    for(int i = 1; i < swap_device.queue_depth; i++) {
+        if(swap_device.channel_free[i] < swap_device.channel_free[channel]) {
+            channel = i;
+        }
+    }
+
+    long start = swap_device.channel_free[channel] > ready ? swap_device.channel_free[channel] : ready;
+    long delay = start - ready;
+    swap_device.queue_delay += delay;
+    if(delay > swap_device.max_queue_delay) {
+        swap_device.max_queue_delay = delay;
+    }
+    swap_device.busy_ticks += latency;
+    swap_device.channel_free[channel] = start + latency;
+    return start + latency;
+}
+
+// 페이지 폴트 하나의 I/O를 넣고 page-in이 끝나는 틱을 반환
+// dirty 페이지를 내보내야 하면 write-back이 끝난 뒤에야 그 프레임으로 읽어 들일 수 있음
+long swap_page_in(int write_back) {
+    long ready = tick_count;
+
+    if(write_back) {
+        ready = swap_submit(ready, swap_device.write_latency);
+        swap_device.writes++;
+    }
+    long done = swap_submit(ready, swap_device.read_latency);
+    swap_device.reads++;
+    swap_device.service_ticks += done - tick_count;
+    return done;
+}
+
+void swap_report(FILE* fp) {
+    fprintf(fp, "\nBacking Store Statistics (read %d, write %d ticks, queue depth %d):\n",
+            swap_device.read_latency, swap_device.write_latency, swap_device.queue_depth);
+    fprintf(fp, "Page-in Reads: %ld\n", swap_device.reads);
+    fprintf(fp, "Write-back Writes: %ld\n", swap_device.writes);
+    if(swap_device.reads > 0) {
+        fprintf(fp, "Average Fault Service Time: %.2f ticks (%.2f queued)\n",
+                (double)swap_device.service_ticks / swap_device.reads,
+                (double)swap_device.queue_delay / (swap_device.reads + swap_device.writes));
+    }
+    fprintf(fp, "Max Queue Delay: %ld ticks\n", swap_device.max_queue_delay);
+    // 시뮬레이션이 끝난 뒤에 완료되는 I/O까지 포함한 구간에 대한 비율
+    long horizon = tick_count;
+    for(int i = 0; i < swap_device.queue_depth; i++) {
+        if(swap_device.channel_free[i] > horizon) {
+            horizon = swap_device.channel_free[i];
+        }
+    }
+    if(horizon > 0) {
+        fprintf(fp, "Device Utilization: %.2f%% (over %ld ticks)\n",
+                (double)swap_device.busy_ticks / ((double)swap_device.queue_depth * horizon) * 100, horizon);
+    }
+    fprintf(fp, "Processes Blocked on Page-in: %ld\n", swap_device.blocked);
+}
+/*--------------------------------------------------------------------------------- */
+
+// Mattson 스택 거리 분석 part
+// LRU는 포함 성질(inclusion property)을 가지므로, 각 요청의 스택 거리 d
+// (직전 사용 이후 접근된 서로 다른 페이지 수 + 1)만 알면
+// 프레임 수가 d 미만인 모든 경우에 그 요청이 폴트라는 것을 알 수 있음.
+// 각 페이지의 마지막 접근 시점에 1을 표시한 Fenwick tree로 d를 O(log n)에 구하므로
+// 한 번의 실행으로 프레임 1개 ~ 전체 페이지 수까지의 폴트 수를 모두 얻음
+
+#define MRC_MIN_CAPACITY 65536                       // Fenwick tree 시간 축 최소 크기
+#define MRC_MAX_PAGES (1 << 29)                      // 시간 축 크기가 int를 넘지 않는 최대 페이지 수
+
+struct StackDistanceAnalyzer {
+    int* tree;                          // Fenwick tree (1부터 시작) [capacity + 1]
+    int capacity;                       // 시간 축 크기 (압축 후에도 빈 자리가 남도록 페이지 수의 2배 이상)
+    int now;                            // 다음 요청에 줄 시간 위치
+    int* last_pos;                      // 페이지별 마지막 접근 시간 위치 (-1: 아직 없음) [total_pages]
+    long* distance_hist;                // 스택 거리별 요청 수 [total_pages + 1]
+    long cold_misses;                   // 처음 접근한 요청 수
+    long total_references;
+};
+
+struct StackDistanceAnalyzer mrc;
+int mrc_enabled = 0;
+const char* mrc_path = NULL;
+
+void mrc_tree_add(int pos, int delta) {
+    for(int i = pos + 1; i <= mrc.capacity; i += i & -i) {
+        mrc.tree[i] += delta;
+    }
+}
+
+// 시간 위치 0 ~ pos 구간의 합
+int mrc_tree_sum(int pos) {
+    int sum = 0;
+    for(int i = pos + 1; i > 0; i -= i & -i) {
+        sum += mrc.tree[i];
+    }
+    return sum;
+}
+
+void mrc_init() {
+    memset(&mrc, 0, sizeof(mrc));
+    mrc.capacity = MRC_MIN_CAPACITY;
+    while(mrc.capacity < 2L * total_pages) {
+        mrc.capacity <<= 1;
+    }
+    mrc.tree = alloc_aligned(mrc.capacity + 1, sizeof(int));
+    mrc.last_pos = alloc_aligned(total_pages, sizeof(int));
+    mrc.distance_hist = alloc_aligned(total_pages + 1, sizeof(long));
+    for(int i = 0; i < total_pages; i++) {
+        mrc.last_pos[i] = -1;
+    }
+}
+
+int compare_last_pos(const void* a, const void* b) {
+    return mrc.last_pos[*(const int*)a] - mrc.last_pos[*(const int*)b];
+}
+
+// 시간 축이 가득 차면 살아있는 표시(페이지당 최대 1개)만 순서대로 앞으로 당겨서 재구성
+void mrc_compact() {
+    int* keys = malloc(sizeof(int) * total_pages);
+    int count = 0;
+
+    if(keys == NULL) {
+        perror("malloc failed");
+        exit(1);
+    }
+    for(int i = 0; i < total_pages; i++) {
+        if(mrc.last_pos[i] != -1) keys[count++] = i;
+    }
+    qsort(keys, count, sizeof(int), compare_last_pos);
+
+    memset(mrc.tree, 0, sizeof(int) * (mrc.capacity + 1));
+    for(int i = 0; i < count; i++) {
+        mrc.last_pos[keys[i]] = i;
+        mrc_tree_add(i, 1);
+    }
+    mrc.now = count;
+    free(keys);
+}
+
+// 요청 하나를 분석기에 넣는 함수
+void mrc_access(int process_num, int page_number) {
+    int key = PAGE_KEY(process_num, page_number);
+    int last = mrc.last_pos[key];
+
+    if(mrc.now == mrc.capacity) {
+        mrc_compact();
+        last = mrc.last_pos[key];
+    }
+
+    mrc.total_references++;
+    if(last == -1) {
+        mrc.cold_misses++;
+    } else {
+        // last 이후에 마지막으로 접근된 서로 다른 페이지 수 + 1 = 스택 거리
+        int distance = mrc_tree_sum(mrc.now - 1) - mrc_tree_sum(last) + 1;
+        mrc.distance_hist[distance]++;
+        mrc_tree_add(last, -1);
+    }
+    mrc_tree_add(mrc.now, 1);
+    mrc.last_pos[key] = mrc.now++;
+}
+
+// 프레임 수별 폴트 수(miss-ratio curve)를 파일로 출력하는 함수
+void mrc_write_curve(const char* path) {
+    FILE* fp = fopen(path, "w");
+    long faults = mrc.total_references - mrc.cold_misses;   // 프레임 0개일 때 콜드 미스를 뺀 폴트 수
+
+    if(fp == NULL) {
+        perror("Failed to open miss-ratio curve file");
+        return;
+    }
+    fprintf(fp, "# LRU miss-ratio curve (Mattson stack distance)\n");
+    fprintf(fp, "# references: %ld, cold misses: %ld\n", mrc.total_references, mrc.cold_misses);
+    fprintf(fp, "# frames faults fault_rate\n");
+    for(int frames = 1; frames <= total_pages; frames++) {
+        // 스택 거리가 frames 이하인 요청은 히트
+        faults -= mrc.distance_hist[frames];
+        fprintf(fp, "%d %ld %.4f\n", frames, faults + mrc.cold_misses,
+                mrc.total_references > 0 ?
+                (double)(faults + mrc.cold_misses) / mrc.total_references : 0.0);
+    }
+    fclose(fp);
+    printf("Miss-ratio curve written to %s\n", path);
+}
+
+// ARC (Adaptive Replacement Cache) 정책 관련 함수들
+// T1: 한 번만 사용된 상주 페이지, T2: 두 번 이상 사용된 상주 페이지
+// B1/B2: T1/T2에서 쫓겨난 페이지의 (프로세스, 페이지) 기록만 남긴 ghost 리스트
+// ghost 히트가 나면 목표 크기 p를 조정해 최근성(T1)과 빈도(T2) 사이 비중을 바꿈
+// 모든 리스트는 page_table 인덱스(PAGE_KEY(프로세스 번호, 페이지 번호))를
+// 키로 하는 배열 위의 이중 연결 리스트이므로 조회/이동이 모두 O(1)
+
+#define ARC_NONE 0
+#define ARC_T1 1
+#define ARC_T2 2
+#define ARC_B1 3
+#define ARC_B2 4
+
+// ARC 리스트 하나 (head: MRU, tail: LRU)
+struct ArcList {
+    int head;
+    int tail;
+    int size;
+};
+
+struct ArcState {
+    struct ArcList lists[5];    // 인덱스는 ARC_T1 ~ ARC_B2 사용
+    int* where;                 // 키가 들어있는 리스트 (ARC_NONE: 어디에도 없음) [total_pages]
+    int* prev;
+    int* next;
+    int p;                      // T1의 목표 크기
+    int target;                 // 이번 폴트에서 적재할 리스트 (ARC_T1 또는 ARC_T2)
+    int discard_t1;             // 이번 폴트에서 T1의 LRU를 ghost 없이 버려야 하는지 여부
+    long b1_hits;               // B1 ghost 히트 수
+    long b2_hits;               // B2 ghost 히트 수
+} arc;
+
+void arc_init() {
+    memset(&arc, 0, sizeof(arc));
+    arc.where = alloc_aligned(total_pages, sizeof(int));
+    arc.prev = alloc_aligned(total_pages, sizeof(int));
+    arc.next = alloc_aligned(total_pages, sizeof(int));
+    for(int i = ARC_T1; i <= ARC_B2; i++) {
+        arc.lists[i].head = -1;
+        arc.lists[i].tail = -1;
+    }
+    for(int i = 0; i < total_pages; i++) {
+        arc.where[i] = ARC_NONE;
+        arc.prev[i] = -1;
+        arc.next[i] = -1;
+    }
+}
+
+// 키를 현재 리스트에서 떼어내는 함수
+void arc_remove(int key) {
+    struct ArcList* list = &arc.lists[arc.where[key]];
+
+    if(arc.prev[key] != -1) {
+        arc.next[arc.prev[key]] = arc.next[key];
+    } else {
+        list->head = arc.next[key];
+    }
+    if(arc.next[key] != -1) {
+        arc.prev[arc.next[key]] = arc.prev[key];
+    } else {
+        list->tail = arc.prev[key];
+    }
+    list->size--;
+    arc.where[key] = ARC_NONE;
+    arc.prev[key] = -1;
+    arc.next[key] = -1;
+}
+
+// 키를 리스트의 MRU 위치에 넣는 함수 (다른 리스트에 있으면 먼저 떼어냄)
+void arc_push_mru(int key, int which) {
+    struct ArcList* list = &arc.lists[which];
+
+    if(arc.where[key] != ARC_NONE) {
+        arc_remove(key);
+    }
+    arc.prev[key] = -1;
+    arc.next[key] = list->head;
+    if(list->head != -1) {
+        arc.prev[list->head] = key;
+    } else {
+        list->tail = key;
+    }
+    list->head = key;
+    list->size++;
+    arc.where[key] = which;
+}
+
+// 상주 페이지 히트: T2의 MRU로 이동
+void arc_on_hit(int frame_num) {
+    int key = PAGE_KEY(pmem.frames[frame_num].page.pid, pmem.frames[frame_num].page.pagenum);
+    arc_push_mru(key, ARC_T2);
+}
+
+// 폴트 발생 시 교체 전에 호출: ghost 히트면 p를 조정하고, 디렉터리 크기를 2c 이하로 유지
+void arc_on_fault(int key) {
+    int c = total_frames;
+    int b1 = arc.lists[ARC_B1].size;
+    int b2 = arc.lists[ARC_B2].size;
+
+    arc.discard_t1 = 0;
+    if(arc.where[key] == ARC_B1) {
+        // 최근성 쪽 ghost 히트: T1 목표 크기를 늘림
+        arc.b1_hits++;
+        arc.p += (b2 > b1) ? b2 / b1 : 1;
+        if(arc.p > c) arc.p = c;
+        arc.target = ARC_T2;
+    } else if(arc.where[key] == ARC_B2) {
+        // 빈도 쪽 ghost 히트: T1 목표 크기를 줄임
+        arc.b2_hits++;
+        arc.p -= (b1 > b2) ? b1 / b2 : 1;
+        if(arc.p < 0) arc.p = 0;
+        arc.target = ARC_T2;
+    } else {
+        // 처음 보는 페이지
+        int t1 = arc.lists[ARC_T1].size;
+        int total = t1 + arc.lists[ARC_T2].size + b1 + b2;
+        if(t1 + b1 == c) {
+            if(t1 < c) {
+                arc_remove(arc.lists[ARC_B1].tail);
+            } else {
+                arc.discard_t1 = 1;
+            }
+        } else if(total >= 2 * c) {
+            arc_remove(arc.lists[ARC_B2].tail);
+        }
+        arc.target = ARC_T1;
+    }
+}
+
+// 교체할 프레임을 고르는 함수 (ARC의 REPLACE)
+// 쫓겨나는 페이지의 키는 B1 또는 B2의 MRU로 옮겨 ghost로 남김
+int arc_victim(int key) {
+    int t1 = arc.lists[ARC_T1].size;
+    int evict_key;
+
+    if(arc.discard_t1) {
+        evict_key = arc.lists[ARC_T1].tail;
+        arc_remove(evict_key);
+    } else if(t1 > 0 && (t1 > arc.p || (arc.where[key] == ARC_B2 && t1 == arc.p))) {
+        evict_key = arc.lists[ARC_T1].tail;
+        arc_push_mru(evict_key, ARC_B1);
+    } else {
+        evict_key = arc.lists[ARC_T2].tail;
+        arc_push_mru(evict_key, ARC_B2);
+    }
+    return page_table_find(evict_key / pages_per_process, evict_key % pages_per_process);
+}
+
+// 적재된 페이지를 arc_on_fault()에서 정한 리스트(T1 또는 T2)의 MRU에 넣음
+void arc_on_load(int frame_num, int key) {
+    (void)frame_num;
+    arc_push_mru(key, arc.target);
+}
+
+// 프로세스 종료로 비워진 프레임의 키는 ghost로 남기지 않고 제거
+void arc_on_free(int frame_num) {
+    int key = PAGE_KEY(pmem.frames[frame_num].page.pid, pmem.frames[frame_num].page.pagenum);
+    if(arc.where[key] != ARC_NONE) {
+        arc_remove(key);
+    }
+}
+
+void arc_report(FILE* fp) {
+    fprintf(fp, "\nARC Statistics:\n");
+    fprintf(fp, "B1 Ghost Hits (recency): %ld\n", arc.b1_hits);
+    fprintf(fp, "B2 Ghost Hits (frequency): %ld\n", arc.b2_hits);
+    fprintf(fp, "Final Target p: %d / %d frames\n", arc.p, total_frames);
+    fprintf(fp, "List Sizes: T1 %d, T2 %d, B1 %d, B2 %d\n",
+            arc.lists[ARC_T1].size, arc.lists[ARC_T2].size,
+            arc.lists[ARC_B1].size, arc.lists[ARC_B2].size);
+}
+
+// OPT(Belady MIN) 정책 관련 함수들
+// 전체 요청 순서를 미리 알고 있을 때(트레이스 재생 등) 각 요청마다
+// "같은 (프로세스, 페이지)가 다음에 다시 요청되는 위치"를 미리 계산해 두고,
+// 다음 사용 위치가 가장 먼 프레임을 max-heap으로 O(log frames)에 찾아 교체
+
+#define OPT_NEVER INT_MAX       // 다시 요청되지 않는 페이지의 다음 사용 위치
+
+// 프레임 번호를 다음 사용 위치 기준으로 관리하는 max-heap
+struct OptHeap {
+    int* next_use;      // 프레임별 다음 사용 위치
+    int* heap_pos;      // 프레임의 힙 내 위치 (-1: 힙에 없음)
+    int* heap;          // 힙 배열 (프레임 번호)
+    int size;
+};
+
+void opt_heap_init(struct OptHeap* h, int num_frames) {
+    h->next_use = alloc_aligned(num_frames, sizeof(int));
+    h->heap_pos = alloc_aligned(num_frames, sizeof(int));
+    h->heap = alloc_aligned(num_frames, sizeof(int));
+    for(int i = 0; i < num_frames; i++) {
+        h->heap_pos[i] = -1;
+    }
+    h->size = 0;
+}
+
+void opt_heap_free(struct OptHeap* h) {
+    free(h->next_use);
+    free(h->heap_pos);
+    free(h->heap);
+}
+
+// 힙 안의 두 원소 위치를 바꾸는 함수
+void opt_heap_swap(struct OptHeap* h, int a, int b) {
+    int tmp = h->heap[a];
+    h->heap[a] = h->heap[b];
+    h->heap[b] = tmp;
+    h->heap_pos[h->heap[a]] = a;
+    h->heap_pos[h->heap[b]] = b;
+}
+
+void opt_heap_sift_up(struct OptHeap* h, int pos) {
+    while(pos > 0) {
+        int parent = (pos - 1) / 2;
+        if(h->next_use[h->heap[parent]] >= h->next_use[h->heap[pos]]) break;
+        opt_heap_swap(h, parent, pos);
+        pos = parent;
+    }
+}
+
+void opt_heap_sift_down(struct OptHeap* h, int pos) {
+    while(1) {
+        int left = pos * 2 + 1;
+        int right = left + 1;
+        int largest = pos;
+        if(left < h->size && h->next_use[h->heap[left]] > h->next_use[h->heap[largest]]) {
+            largest = left;
+        }
+        if(right < h->size && h->next_use[h->heap[right]] > h->next_use[h->heap[largest]]) {
+            largest = right;
+        }
+        if(largest == pos) break;
+        opt_heap_swap(h, pos, largest);
+        pos = largest;
+    }
+}
+
+// 프레임의 다음 사용 위치를 갱신하는 함수 (힙에 없으면 새로 넣음)
+void opt_heap_update(struct OptHeap* h, int frame, int next_use) {
+    if(h->heap_pos[frame] == -1) {
+        h->heap_pos[frame] = h->size;
+        h->heap[h->size++] = frame;
+    }
+    h->next_use[frame] = next_use;
+    opt_heap_sift_up(h, h->heap_pos[frame]);
+    opt_heap_sift_down(h, h->heap_pos[frame]);
+}
+
+// 프레임을 힙에서 빼는 함수
+void opt_heap_remove(struct OptHeap* h, int frame) {
+    int pos = h->heap_pos[frame];
+
+    if(pos == -1) return;
+    h->size--;
+    if(pos != h->size) {
+        opt_heap_swap(h, pos, h->size);
+        opt_heap_sift_up(h, pos);
+        opt_heap_sift_down(h, h->heap_pos[h->heap[pos]]);
+    }
+    h->heap_pos[frame] = -1;
+}
+
+// 요청 순서에서 각 요청의 다음 사용 위치 배열을 만드는 함수 (뒤에서부터 한 번 훑음, O(n))
+int* opt_build_next_use(const struct TraceRecord* seq, long n) {
+    int* next_use = malloc(sizeof(int) * (n > 0 ? n : 1));
+    int* last_seen = malloc(sizeof(int) * total_pages);
+
+    if(next_use == NULL || last_seen == NULL) {
+        perror("malloc failed");
+        exit(1);
+    }
+    for(int i = 0; i < total_pages; i++) {
+        last_seen[i] = OPT_NEVER;
+    }
+    for(long i = n - 1; i >= 0; i--) {
+        int key = PAGE_KEY(seq[i].process_num, seq[i].page_number);
+        next_use[i] = last_seen[key];
+        last_seen[key] = (int)i;
+    }
+    free(last_seen);
+    return next_use;
+}
+
+// OPT 정책 상태
+struct OptHeap opt_heap;
+int* opt_next_use = NULL;       // 재생할 요청 순서의 다음 사용 위치
+long opt_sequence_length = 0;
+
+void opt_init() {
+    opt_heap_init(&opt_heap, total_frames);
+}
+
+// 앞으로 처리할 전체 요청 순서를 받아 다음 사용 위치를 미리 계산
+void opt_prepare(const struct TraceRecord* seq, long n) {
+    free(opt_next_use);
+    opt_next_use = opt_build_next_use(seq, n);
+    opt_sequence_length = n;
+}
+
+// 현재 요청의 다음 사용 위치
+int opt_current_next_use() {
+    if(reference_index >= opt_sequence_length) {
+        fprintf(stderr, "OPT: request %ld is beyond the prepared sequence\n", reference_index);
+        exit(1);
+    }
+    return opt_next_use[reference_index];
+}
+
+void opt_on_hit(int frame_num) {
+    opt_heap_update(&opt_heap, frame_num, opt_current_next_use());
+}
+
+int opt_choose_victim(int key) {
+    (void)key;
+    return opt_heap.heap[0];    // 다음 사용이 가장 먼 프레임
+}
+
+void opt_on_load(int frame_num, int key) {
+    (void)key;
+    opt_heap_update(&opt_heap, frame_num, opt_current_next_use());
+}
+
+void opt_on_free(int frame_num) {
+    opt_heap_remove(&opt_heap, frame_num);
+}
+
+void opt_report(FILE* fp) {
+    fprintf(fp, "\nOPT Statistics:\n");
+    fprintf(fp, "Prepared Sequence Length: %ld\n", opt_sequence_length);
+}
+
+// Belady OPT 기준치 계산 part
+// 어떤 정책/모드로 실행하든 처리한 요청 순서를 기록해 두었다가, 종료 시 같은 순서에
+// Belady OPT를 적용한 결과를 함께 출력해 실제 정책과 비교할 수 있게 함
+
+struct TraceRecord* ref_seq = NULL;
+long ref_count = 0;
+long ref_capacity = 0;
+int belady_enabled = 0;
+
+// 요청 하나를 reference string 끝에 추가하는 함수
+void record_reference(int process_num, int page_number) {
+    if(ref_count == ref_capacity) {
+        long new_capacity = (ref_capacity == 0) ? 1024 : ref_capacity * 2;
+        struct TraceRecord* new_seq = realloc(ref_seq, sizeof(struct TraceRecord) * new_capacity);
+        if(new_seq == NULL) {
+            perror("realloc failed");
+            exit(1);
+        }
+        ref_seq = new_seq;
+        ref_capacity = new_capacity;
+    }
+    ref_seq[ref_count].tick = tick_count;
+    ref_seq[ref_count].process_num = process_num;
+    ref_seq[ref_count].page_number = page_number;
+    ref_seq[ref_count].offset = 0;
+    ref_seq[ref_count].flags = 0;
+    ref_count++;
+}
+
+// OPT 결과 통계
+struct OptStatistics {
+    int computed;       // OPT 계산을 수행했는지 여부
+    long total_references;
+    long total_page_faults;
+    long total_page_hits;
+    long total_page_replacements;
+    long* page_faults_per_process;    // [num_children]
+} opt_stats = {0};
+
+// 주어진 요청 순서에 Belady OPT를 적용해 opt_stats를 채우는 함수
+void run_belady_opt(const struct TraceRecord* seq, long n, int num_frames) {
+    int* next_use = opt_build_next_use(seq, n);
+    int* resident = malloc(sizeof(int) * total_pages);     // 페이지가 올라간 프레임 (-1: 없음)
+    struct Page* frame_page = malloc(sizeof(struct Page) * num_frames);
+    struct OptHeap heap;
+    int used_frames = 0;
+
+    if(resident == NULL || frame_page == NULL) {
+        perror("malloc failed");
+        exit(1);
+    }
+    for(int i = 0; i < total_pages; i++) {
+        resident[i] = -1;
+    }
+    opt_heap_init(&heap, num_frames);
+    memset(&opt_stats, 0, sizeof(opt_stats));
+    opt_stats.page_faults_per_process = alloc_aligned(num_children, sizeof(long));
+
+    for(long i = 0; i < n; i++) {
+        int p = seq[i].process_num;
+        int pg = seq[i].page_number;
+        int frame = resident[PAGE_KEY(p, pg)];
+
+        if(frame != -1) {
+            opt_stats.total_page_hits++;
+        } else {
+            opt_stats.total_page_faults++;
+            opt_stats.page_faults_per_process[p]++;
+            if(used_frames < num_frames) {
+                frame = used_frames++;
+            } else {
+                // 힙의 root = 다음 사용이 가장 먼 프레임을 교체
+                frame = heap.heap[0];
+                resident[PAGE_KEY(frame_page[frame].pid, frame_page[frame].pagenum)] = -1;
+                opt_stats.total_page_replacements++;
+            }
+            frame_page[frame].pid = p;
+            frame_page[frame].pagenum = pg;
+            resident[PAGE_KEY(p, pg)] = frame;
+        }
+        opt_heap_update(&heap, frame, next_use[i]);
+    }
+
+    opt_stats.total_references = n;
+    opt_stats.computed = 1;
+    opt_heap_free(&heap);
+    free(frame_page);
+    free(resident);
+    free(next_use);
+}
+
+// 교체 정책 목록 (-P 옵션 이름으로 선택)
+struct ReplacementPolicy policies[NUM_POLICIES] = {
+    [POLICY_LRU] = {
+        .name = "LRU",
+        .on_hit = lru_on_hit,
+        .choose_victim = lru_victim,
+        .choose_clean_victim = lru_clean_victim,
+        .on_evict = lru_unlink,
+        .on_load = lru_on_load,
+        .on_free = lru_unlink,
+    },
+    [POLICY_CLOCK] = {
+        .name = "CLOCK",
+        .on_hit = clock_on_hit,
+        .choose_victim = clock_victim,
+        .choose_clean_victim = clock_clean_victim,
+        .on_load = clock_on_load,
+        .report = clock_report,
+    },
+    [POLICY_ARC] = {
+        .name = "ARC",
+        .init = arc_init,
+        .on_hit = arc_on_hit,
+        .on_fault = arc_on_fault,
+        .choose_victim = arc_victim,
+        .on_load = arc_on_load,
+        .on_free = arc_on_free,
+        .report = arc_report,
+    },
+    [POLICY_OPT] = {
+        .name = "OPT",
+        .init = opt_init,
+        .prepare = opt_prepare,
+        .on_hit = opt_on_hit,
+        .choose_victim = opt_choose_victim,
+        .on_load = opt_on_load,
+        .on_free = opt_on_free,
+        .report = opt_report,
+    },
+    [POLICY_AGING] = {
+        .name = "AGING",
+        .on_hit = aging_on_hit,
+        .on_fault = aging_on_fault,
+        .choose_victim = aging_victim,
+        .choose_clean_victim = aging_clean_victim,
+        .on_load = aging_on_load,
+        .on_free = aging_on_free,
+        .report = aging_report,
+    },
+};
+
+// 이름으로 교체 정책을 찾는 함수 (없으면 NULL)
+struct ReplacementPolicy* find_policy(const char* name) {
+    for(int i = 0; i < NUM_POLICIES; i++) {
+        if(strcasecmp(policies[i].name, name) == 0) {
+            return &policies[i];
+        }
+    }
+    return NULL;
+}
+/*--------------------------------------------------------------------------------- */
+
+//로깅 관련 함수들
+
+// 통계 업데이트 함수들
+void record_page_fault(int process_num) {
+    stats.total_page_faults++;
+    stats.page_faults_per_process[process_num]++;
+}
+
+void record_page_hit(int process_num) {
+    stats.total_page_hits++;
+    stats.page_hits_per_process[process_num]++;
+}
+
+void record_page_replacement() {
+    stats.total_page_replacements++;
+}
+// 로그 버퍼
+// write_log()는 파일에 바로 쓰지 않고 메모리 버퍼에 포맷만 해 두고,
+// 틱 경계(log_tick_boundary)에서 일정 크기 이상 쌓였을 때 한 번의 큰 write로 비움
+struct LogBuffer {
+    char data[LOG_BUFFER_SIZE];
+    size_t used;            // 버퍼에 쌓인 바이트 수
+    int full_mode;          // 버퍼가 가득 찼을 때 동작 (LOG_FULL_BLOCK / LOG_FULL_DROP)
+    long drains;            // 파일로 비운 횟수
+    long bytes_written;     // 파일로 쓴 총 바이트 수
+    long dropped_lines;     // LOG_FULL_DROP 모드에서 버린 로그 줄(이벤트 로그 모드에서는 이벤트) 수
+};
+
+struct LogBuffer log_buffer = { .full_mode = LOG_FULL_BLOCK };
+
+// 버퍼에 쌓인 로그를 한 번에 파일로 쓰는 함수
+// 이벤트 로그 모드에서는 이벤트 파일로, 아니면 텍스트 로그 파일로 씀
+void drain_log_buffer() {
+    FILE* out = event_log_enabled ? event_file : log_file;
+    if(log_buffer.used == 0) return;
+    if(fwrite(log_buffer.data, 1, log_buffer.used, out) != log_buffer.used) {
+        perror("Failed to write log file");
+    }
+    fflush(out);
+    log_buffer.drains++;
+    log_buffer.bytes_written += log_buffer.used;
+    log_buffer.used = 0;
+}
+
+// 틱이 끝날 때마다 호출: 충분히 쌓였을 때만 파일로 씀
+void log_tick_boundary() {
+    if(log_buffer.used >= LOG_FLUSH_THRESHOLD) {
+        drain_log_buffer();
+    }
+}
+
+// 로그 작성을 위한 함수
+void write_log(const char* format, ...) {
+    va_list args;
+    size_t space = LOG_BUFFER_SIZE - log_buffer.used;
+
+    va_start(args, format);
+    int len = vsnprintf(log_buffer.data + log_buffer.used, space, format, args);
+    va_end(args);
+    if(len < 0) return;
+
+    if((size_t)len >= space) {
+        // 남은 공간에 다 들어가지 않음
+        if(log_buffer.full_mode == LOG_FULL_DROP) {
+            log_buffer.dropped_lines++;
+            return;
+        }
+        drain_log_buffer();
+        va_start(args, format);
+        len = vsnprintf(log_buffer.data, LOG_BUFFER_SIZE, format, args);
+        va_end(args);
+        if(len < 0) return;
+        if((size_t)len >= LOG_BUFFER_SIZE) len = LOG_BUFFER_SIZE - 1;  // 한 줄이 버퍼보다 큰 경우 잘라냄
+    }
+    log_buffer.used += len;
+}
+
+// 이벤트 레코드(종류 1바이트 + 본문)를 로그 버퍼에 추가하는 함수
+void write_event(int type, const void* payload, size_t size) {
+    if(log_buffer.used + 1 + size > LOG_BUFFER_SIZE) {
+        if(log_buffer.full_mode == LOG_FULL_DROP) {
+            log_buffer.dropped_lines++;
+            return;
+        }
+        drain_log_buffer();
+    }
+    log_buffer.data[log_buffer.used++] = (char)type;
+    // 본문이 없는 이벤트(EVENT_SNAPSHOT_BEGIN)는 payload가 NULL이므로 복사하지 않음
+    if(size > 0) {
+        memcpy(log_buffer.data + log_buffer.used, payload, size);
+        log_buffer.used += size;
+    }
+}
+// 최종 통계 출력 함수
+void print_final_statistics() {
+    fprintf(log_file, "\n======================================================\n");
+    fprintf(log_file, "Final Memory Management Statistics\n");
+    fprintf(log_file, "======================================================\n\n");
+    
+    fprintf(log_file, "Replacement Policy: %s\n", policy->name);
+    fprintf(log_file, "Workload: %s\n\n", workload == WORKLOAD_SEQUENTIAL ? "sequential" : "random");
+    fprintf(log_file, "Overall Statistics:\n");
+    fprintf(log_file, "Total Memory Accesses: %d\n", 
+            stats.total_page_faults + stats.total_page_hits);
+    fprintf(log_file, "Total Page Faults: %d\n", stats.total_page_faults);
+    fprintf(log_file, "Total Page Hits: %d\n", stats.total_page_hits);
+    fprintf(log_file, "Total Page Replacements: %d\n", stats.total_page_replacements);
+    if(process_lifetime > 0) {
+        fprintf(log_file, "Process Exits: %d (released %d frames)\n",
+                stats.process_exits, stats.released_frames);
+    }
+    fprintf(log_file, "Page Fault Rate: %.2f%%\n", 
+            (float)stats.total_page_faults / (stats.total_page_faults + stats.total_page_hits) * 100);
+    fprintf(log_file, "Page Hit Rate: %.2f%%\n", 
+            (float)stats.total_page_hits / (stats.total_page_faults + stats.total_page_hits) * 100);
+
+    // 폴트마다 페이지를 읽고(page-in), dirty 페이지를 내보낼 때 씀(page-out)
+    int page_ins = stats.total_page_faults;
+    int page_outs = stats.total_write_backs;
+    fprintf(log_file, "\nWrite-back Statistics (%s victims):\n", clean_first ? "clean-first" : "policy order");
+    fprintf(log_file, "Write Accesses: %d\n", stats.total_writes);
+    fprintf(log_file, "Dirty Evictions (Write-backs): %d\n", stats.total_write_backs);
+    fprintf(log_file, "Clean Evictions: %d\n", stats.total_page_replacements - stats.total_write_backs);
+    fprintf(log_file, "Backing Store I/O: %d (%d page-ins, %d page-outs)\n", page_ins + page_outs, page_ins, page_outs);
+    if(page_ins + page_outs > 0) {
+        fprintf(log_file, "Write-back Share of I/O: %.2f%%\n", (float)page_outs / (page_ins + page_outs) * 100);
+    }
+    if(swap_device.enabled) {
+        swap_report(log_file);
+    }
+    
+    tlb_report(log_file);
+    page_table_report(log_file);
+
+    if(policy->report != NULL) {
+        policy->report(log_file);
+    }
+
+    fprintf(log_file, "\nRun Statistics:\n");
+    if(headless_mode || replay_path != NULL || tick_period_us == 0) {
+        fprintf(log_file, "Tick Period: unthrottled\n");
+    } else {
+        fprintf(log_file, "Tick Period: %ld us\n", tick_period_us);
+    }
+    fprintf(log_file, "Ticks: %d\n", tick_count);
+    fprintf(log_file, "Elapsed: %.3f s\n", run_elapsed);
+    if(run_elapsed > 0) {
+        fprintf(log_file, "Tick Rate: %.0f ticks/sec\n", tick_count / run_elapsed);
+    }
+    if(replay_path == NULL && tick_count > 0) {
+        // 틱마다 실행 중인 프로세스가 요청 하나를 처리하므로, 폴트 대기로 CPU가 노는 틱만큼 처리량이 줄어듦
+        fprintf(log_file, "CPU Utilization: %.2f%% (%ld busy, %ld idle ticks)\n",
+                (double)stats.cpu_busy_ticks / tick_count * 100,
+                stats.cpu_busy_ticks, tick_count - stats.cpu_busy_ticks);
+        fprintf(log_file, "Throughput: %.3f accesses/tick\n",
+                (double)stats.total_memory_accesses / tick_count);
+    }
+
+    if(tick_stats.timer_reads > 0) {
+        fprintf(log_file, "\nTick Timing Statistics (period %ld us):\n", tick_period_us);
+        fprintf(log_file, "Timer Reads: %ld\n", tick_stats.timer_reads);
+        fprintf(log_file, "Timer Overruns: %ld\n", tick_stats.overruns);
+        fprintf(log_file, "Late Ticks: %ld\n", tick_stats.late_ticks);
+        fprintf(log_file, "Max Tick Lag: %ld us\n", tick_stats.max_lag_us);
+        fprintf(log_file, "Request Wakeups: %ld\n", tick_stats.request_wakeups);
+    }
+
+    fprintf(log_file, "\nLog Buffer Statistics:\n");
+    fprintf(log_file, "Drains: %ld (%ld bytes)\n", log_buffer.drains, log_buffer.bytes_written);
+    fprintf(log_file, "Dropped Log %s: %ld\n", event_log_enabled ? "Events" : "Lines",
+            log_buffer.dropped_lines);
+    if(event_log_enabled) {
+        fprintf(log_file, "Event Log: %s\n", event_log_path);
+    }
+    
+    fprintf(log_file, "\nPer-Process Statistics:\n");
+    for(int i = 0; i < num_children; i++) {
+        int total = stats.page_faults_per_process[i] + stats.page_hits_per_process[i];
+        fprintf(log_file, "Process P%d:\n", i);
+        fprintf(log_file, "  Total Accesses: %d\n", total);
+        fprintf(log_file, "  Page Faults: %d\n", stats.page_faults_per_process[i]);
+        fprintf(log_file, "  Page Hits: %d\n", stats.page_hits_per_process[i]);
+        if(total > 0) {
+            fprintf(log_file, "  Page Fault Rate: %.2f%%\n",
+                    (float)stats.page_faults_per_process[i] / total * 100);
+            fprintf(log_file, "  Page Hit Rate: %.2f%%\n",
+                    (float)stats.page_hits_per_process[i] / total * 100);
+        }
+        if(stats.total_writes > 0) {
+            fprintf(log_file, "  Write-backs: %d\n", stats.write_backs_per_process[i]);
+        }
+        fprintf(log_file, "\n");
+    }
+
+    // 같은 요청 순서에 대한 Belady OPT 기준치
+    if(opt_stats.computed) {
+        fprintf(log_file, "Belady OPT Statistics (same reference string, %d frames):\n", total_frames);
+        fprintf(log_file, "Total References: %ld\n", opt_stats.total_references);
+        fprintf(log_file, "Total Page Faults: %ld\n", opt_stats.total_page_faults);
+        fprintf(log_file, "Total Page Hits: %ld\n", opt_stats.total_page_hits);
+        fprintf(log_file, "Total Page Replacements: %ld\n", opt_stats.total_page_replacements);
+        if(opt_stats.total_references > 0) {
+            fprintf(log_file, "Page Fault Rate: %.2f%%\n",
+                    (float)opt_stats.total_page_faults / opt_stats.total_references * 100);
+        }
+        for(int i = 0; i < num_children; i++) {
+            fprintf(log_file, "  Process P%d Page Faults: %ld\n", i, opt_stats.page_faults_per_process[i]);
+        }
+        fprintf(log_file, "\n");
+    }
+    
+    fprintf(log_file, "======================================================\n");
+}
+
+// 로그 파일 초기화 함수
+void init_logging() {
+    log_file = fopen("memory_management.txt", "w");
+    if (log_file == NULL) {
+        perror("Failed to open log file");
+        exit(1);
+    }
+    
+    // 로그 파일 헤더 작성
+    fprintf(log_file, "======================================================\n");
+    fprintf(log_file, "Virtual Memory Management Simulation Log\n");
+    fprintf(log_file, "======================================================\n\n");
+    // fork 전에 비워 두어야 자식에게 같은 내용이 복사되지 않음
+    fflush(log_file);
+
+    if(event_log_enabled) {
+        struct EventLogHeader header;
+
+        event_file = fopen(event_log_path, "wb");
+        if(event_file == NULL) {
+            perror("Failed to open event log");
+            exit(1);
+        }
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, EVENT_LOG_MAGIC, 4);
+        header.version = EVENT_LOG_VERSION;
+        strncpy(header.policy, policy->name, sizeof(header.policy) - 1);
+        if(fwrite(&header, sizeof(header), 1, event_file) != 1) {
+            perror("Failed to write event log header");
+            exit(1);
+        }
+        fflush(event_file);
+    }
+}
+
+// 구분선 출력 함수
+void log_separator() {
+    write_log("------------------------------------------------------\n");
+}
+
+// 메모리 접근 로깅 함수
+void log_memory_access(int tick, int process_num, int page_num, int offset, int write, int frame_num, int status) {
+    if(event_log_enabled) {
+        struct EventMemoryAccess ev = { tick, process_num, page_num, offset, frame_num, status, write };
+        write_event(EVENT_MEMORY_ACCESS, &ev, sizeof(ev));
+        return;
+    }
+    write_log("[Tick %d] Memory Access\n", tick);
+    write_log("Process: P%d\n", process_num);
+    write_log("Virtual Address: Page %d, Offset 0x%x\n", page_num, offset);
+    if(write) {
+        write_log("Access: Write\n");
+    }
+    
+    if (frame_num != -1) {
+        write_log("Physical Address: Frame %d, Offset 0x%x\n", frame_num, offset);
+    }
+    
+    write_log("Status: %s\n", event_status_text[status]);
+    write_log("------------------------------------------------------\n");
+}
+
+// 페이지 폴트 로깅 함수
+void log_page_fault(int tick, int process_num, int page_num) {
+    if(event_log_enabled) {
+        struct EventPageFault ev = { tick, process_num, page_num };
+        write_event(EVENT_PAGE_FAULT, &ev, sizeof(ev));
+        return;
+    }
+    write_log("[Tick %d] PAGE FAULT\n", tick);
+    write_log("Process: P%d\n", process_num);
+    write_log("Faulting Page: %d\n", page_num);
+    write_log("------------------------------------------------------\n");
+}
+
+// 페이지 테이블 변경 로깅 함수
+void log_page_table_update(int tick, int process_num, int page_num, int new_frame) {
+    if(event_log_enabled) {
+        struct EventPageTableUpdate ev = { tick, process_num, page_num, new_frame };
+        write_event(EVENT_PAGE_TABLE_UPDATE, &ev, sizeof(ev));
+        return;
+    }
+    write_log("[Tick %d] Page Table Update\n", tick);
+    write_log("Process: P%d\n", process_num);
+    write_log("Page Number: %d\n", page_num);
+    write_log("New Frame: %d\n", new_frame);
+    write_log("------------------------------------------------------\n");
+}
+
+// LRU 페이지 교체 로깅 함수
+void log_page_replacement(int tick, int evicted_pid, int evicted_page, int new_pid, int new_page, int frame, int write_back) {
+    if(event_log_enabled) {
+        struct EventPageReplacement ev = { tick, evicted_pid, evicted_page, new_pid, new_page, frame, write_back };
+        write_event(EVENT_PAGE_REPLACEMENT, &ev, sizeof(ev));
+        return;
+    }
+    write_log("[Tick %d] %s Page Replacement\n", tick, policy->name);
+    write_log("Evicted Process: P%d, Page: %d\n", evicted_pid, evicted_page);
+    write_log("New Process: P%d, Page: %d\n", new_pid, new_page);
+    write_log("Frame Number: %d\n", frame);
+    if(write_back) {
+        write_log("Write-back: Dirty page written to backing store\n");
+    }
+    write_log("------------------------------------------------------\n");
+}
+
+// 메모리 상태 스냅샷을 이벤트 레코드로 기록하는 함수
+void log_memory_snapshot_event() {
+    struct EventSnapshotEnd end = { pmem.free_frame_count };
+
+    write_event(EVENT_SNAPSHOT_BEGIN, NULL, 0);
+    for(int i = 0; i < total_frames; i++) {
+        struct EventSnapshotFrame ev = { i, EVENT_FRAME_FREE, 0, 0, 0 };
+        if(pmem.frames[i].is_used) {
+            ev.pid = pmem.frames[i].page.pid;
+            ev.page = pmem.frames[i].page.pagenum;
+            if(policy == &policies[POLICY_CLOCK]) {
+                ev.kind = (i == pmem.clock_hand) ? EVENT_FRAME_HAND : EVENT_FRAME_REFERENCED;
+                ev.value = pmem.frames[i].referenced;
+            } else {
+                ev.kind = EVENT_FRAME_LAST_ACCESS;
+                ev.value = pmem.last_access_time[i];
+            }
+        }
+        write_event(EVENT_SNAPSHOT_FRAME, &ev, sizeof(ev));
+    }
+    write_event(EVENT_SNAPSHOT_END, &end, sizeof(end));
+}
+
+// 메모리 상태 스냅샷 로깅 함수
+void log_memory_snapshot() {
+    if(event_log_enabled) {
+        log_memory_snapshot_event();
+        return;
+    }
+    write_log("\n=== Physical Memory Snapshot ===\n");
+    for(int i = 0; i < total_frames; i++) {
+        if(pmem.frames[i].is_used) {
+            if(policy == &policies[POLICY_CLOCK]) {
+                write_log("Frame %2d: Process P%d, Page 0x%x, Referenced: %d%s\n",
+                        i, pmem.frames[i].page.pid, pmem.frames[i].page.pagenum,
+                        pmem.frames[i].referenced, (i == pmem.clock_hand) ? " <- hand" : "");
+            } else {
+                write_log("Frame %2d: Process P%d, Page 0x%x, Last Access: %d\n",
+                        i, pmem.frames[i].page.pid, pmem.frames[i].page.pagenum,
+                        pmem.last_access_time[i]);
+            }
+        } else {
+            write_log("Frame %2d: Free\n", i);
+        }
+    }
+    write_log("Free Frames: %d\n", pmem.free_frame_count);
+    log_separator();
+}
+
+// 주기적인 통계 로깅 함수
+void log_statistics(int tick) {
+    static int total_page_faults = 0;
+    static int total_page_hits = 0;
+    static int total_replacements = 0;
+
+    if(event_log_enabled) {
+        struct EventStatistics ev = { tick, total_page_faults, total_page_hits, total_replacements };
+        write_event(EVENT_STATISTICS, &ev, sizeof(ev));
+        return;
+    }
+    
+    write_log("\n=== Statistics at Tick %d ===\n", tick);
+    write_log("Total Page Faults: %d\n", total_page_faults);
+    write_log("Total Page Hits: %d\n", total_page_hits);
+    write_log("Total Page Replacements: %d\n", total_replacements);
+    write_log("Page Fault Rate: %.2f%%\n", 
+            (float)total_page_faults / (total_page_faults + total_page_hits) * 100);
+    log_separator();
+}
+
+// 로깅 종료 함수
+// close_logging 함수 수정
+void close_logging() {
+    if (log_file != NULL) {
+        drain_log_buffer();
+        print_final_statistics();
+        fclose(log_file);
+    }
+    if (event_file != NULL) {
+        fclose(event_file);
+    }
+}
+/*--------------------------------------------------------------------------------- */
+
+
+// running queue의 첫 번째 프로세스를 running 상태로 만드는 함수
+void set_process_running() {
+    if(running_queue.size > 0) {
+        struct Process* current = queue_front(&running_queue);
+        tlb_switch(current->p_num);
+        if(headless_mode) {
+            // 자식 프로세스가 없으므로 시그널 핸들러가 하던 일을 직접 수행
+            current->is_running = 1;
+            current->request_sent = 0;
+        } else {
+            // 자식의 실행 제어 블록을 갱신하고 futex로 깨움
+            struct ChildControl* control = &child_controls[current->p_num];
+            atomic_store_explicit(&control->running, 1, memory_order_relaxed);
+            atomic_fetch_add_explicit(&control->dispatch_seq, 1, memory_order_release);
+            wake_waiters(&control->dispatch_seq);
+        }
+        TRACE_KERNEL("[KERNEL] Set process %d to RUNNING state\n", current->pid);
+    }
+}
+
+// 프로세스를 waiting 상태로 만드는 함수
+void set_process_waiting(struct Process* process) {
+    if(headless_mode) {
+        process->is_running = 0;
+    } else {
+        // 다음 실행 요청 전까지 자식은 잠든 상태로 남음
+        atomic_store_explicit(&child_controls[process->p_num].running, 0, memory_order_relaxed);
+    }
+    TRACE_KERNEL("[KERNEL] Set process %d to WAITING state\n", process->pid);
+}
+// 프로세스 실행 관련 함수들
+void print_queue_status() {
+    TRACE_VERBOSE("\n==============================================\n");
+    if(running_queue.size > 0) {
+        TRACE_VERBOSE("현재 실행중인 프로세스: %d번\n", queue_front(&running_queue)->p_num);
+    } else {
+        TRACE_VERBOSE("현재 실행중인 프로세스: 없음\n");
+    }
+    
+    // Running Queue 출력
+    TRACE_VERBOSE("Running Queue : |");
+    for(int i = 0; i < running_queue.size; i++) {
+        TRACE_VERBOSE(" %d |", queue_at(&running_queue, i)->p_num);
+    }
+    TRACE_VERBOSE("\n");
+    
+    // Waiting Queue 출력 (출력용이므로 프로세스 번호 순서)
+    TRACE_VERBOSE("Waiting Queue : |");
+    for(int i = 0; i < num_children && waiting_queue.size > 0; i++) {
+        if(processes[i].state == PROCESS_WAITING) {
+            TRACE_VERBOSE(" %d |", processes[i].p_num);
+        }
+    }
+    TRACE_VERBOSE("\n");
+    TRACE_VERBOSE("==============================================\n");
+}
+// 현재 실행 중인 프로세스의 CPU burst 감소
+void decrease_cpu_burst() {
+    if(running_queue.size == 0) return;
+    struct Process* current = queue_front(&running_queue);
+    if(current->cpu_burst > 0) {
+        current->cpu_burst--;
+        TRACE_VERBOSE("Process %d's CPU burst decreased to %d\n", 
+               current->p_num, 
+               current->cpu_burst);
+    }
+}
+// running queue에서 프로세스를 맨 뒤로 이동
+void move_to_back_of_running_queue() {
+    if(running_queue.size <= 1) return;  // 프로세스가 1개 이하면 이동 필요없음
+    
+    struct Process* current = queue_front(&running_queue);
+    // 현재 프로세스를 맨 뒤로 이동 (원형 큐이므로 head만 이동)
+    queue_rotate(&running_queue);
+    
+    TRACE_VERBOSE("Process %d moved to back of running queue\n", current->pid);
+}
+// running queue에서 waiting queue로 프로세스 이동
+void move_to_waiting_queue() {
+    if(running_queue.size <= 0) return;
+    
+    struct Process* process = queue_pop_front(&running_queue);
+    set_process_waiting(process); 
+    process->wait_burst = 10;  // waiting burst 초기화
+    process->cpu_burst = 10;   // CPU burst도 다음을 위해 초기화
+
+    // 수명이 다하면 종료: 프레임을 모두 반납하고, 깨어나면 빈 상태의 새 프로세스로 다시 실행
+    if(process_lifetime > 0 && ++process->bursts_done >= process_lifetime) {
+        int released = release_process_frames(process->p_num);
+        process->bursts_done = 0;
+        stats.process_exits++;
+        stats.released_frames += released;
+        TRACE_KERNEL("[KERNEL] Process %d exited, released %d frames\n", process->pid, released);
+    }
+
+    // wait_burst 틱 뒤에 깨어나도록 타이머 휠에 추가
+    process->state = PROCESS_WAITING;
+    process->wake_tick = tick_count + process->wait_burst;
+    wheel_insert(&waiting_queue, process);
+    
+    TRACE_VERBOSE("Process %d moved to waiting queue (wakes at tick %ld)\n", process->pid, process->wake_tick);
+}
+// 페이지 폴트를 낸 프로세스를 page-in이 끝나는 틱까지 waiting queue로 보냄 (-S)
+// fork 모드에서 요청이 늦게 처리되어 이미 CPU burst 대기 중이면 그대로 둠
+void move_to_page_in_wait(struct Process* process, long ready_tick) {
+    if(process->state == PROCESS_WAITING) return;
+    if(!queue_remove(&running_queue, process)) return;
+
+    set_process_waiting(process);
+    process->io_wait = 1;
+    process->state = PROCESS_WAITING;
+    process->wake_tick = ready_tick;
+    wheel_insert(&waiting_queue, process);
+    swap_device.blocked++;
+
+    TRACE_VERBOSE("Process %d waits for page-in (wakes at tick %ld)\n", process->pid, process->wake_tick);
+}
+// 깨어난 프로세스를 running queue로 이동
+void move_to_running_queue(struct Process* process) {
+    if(process->io_wait) {
+        process->io_wait = 0;     // page-in 대기였으면 남은 CPU burst를 이어서 실행
+    } else {
+        process->cpu_burst = 10;  // CPU burst 초기화
+    }
+    process->wait_burst = 10;  // wait burst도 다음을 위해 초기화
+    process->state = PROCESS_READY;
+    waiting_queue.size--;
+    
+    // running queue에 추가
+    if(queue_push_back(&running_queue, process)) {
+        TRACE_VERBOSE("Process %d moved to running queue\n", process->pid);
+    }
+}
+// 프로세스 번호 찾기 함수 추가
+int get_process_num(pid_t pid) {
+    for(int i = 0; i < num_children; i++) {
+        if(processes[i].pid == pid) {
+            return i;
+        }
+    }
+    return -1;
+}
+void process_waiting_queue() {
+    // 마지막으로 처리한 틱부터 현재 틱까지 휠을 진행하며 깨어날 프로세스만 꺼냄
+    while(waiting_queue.now < tick_count) {
+        long now = ++waiting_queue.now;
+        int index = now & WHEEL_MASK;
+
+        if(waiting_queue.size == 0) continue;
+        if(index == 0) {
+            int index1 = (now >> WHEEL_BITS) & WHEEL_MASK;
+            if(index1 == 0) {
+                wheel_cascade(&waiting_queue, 2, (now >> (WHEEL_BITS * 2)) & WHEEL_MASK);
+            }
+            wheel_cascade(&waiting_queue, 1, index1);
+        }
+
+        struct Process* process = waiting_queue.slots[0][index].head;
+        waiting_queue.slots[0][index].head = NULL;
+        waiting_queue.slots[0][index].tail = NULL;
+        while(process != NULL) {
+            struct Process* next = process->wheel_next;
+            TRACE_VERBOSE("Process %d's wait burst finished at tick %ld\n", process->pid, now);
+            move_to_running_queue(process);
+            process = next;
+        }
+    }
+}
+// 프로세스의 다음 페이지 요청을 만드는 함수 (fork 모드의 자식과 headless 모드가 같이 사용)
+void generate_page_request(int p_num, struct msg_buffer* message) {
+    message->msg_type = 1;
+    message->process_num = p_num;
+    message->page_number = processes[p_num].next_page;
+    if(workload == WORKLOAD_SEQUENTIAL) {
+        // 다음 페이지 번호로 이동 (0→1→2→...→9→0→1→...)
+        processes[p_num].next_page = (processes[p_num].next_page + 1) % pages_per_process;
+    } else {
+        processes[p_num].next_page = rand() % pages_per_process;
+    }
+    message->offset = rand() % PAGE_SIZE;
+    message->write = (write_percent > 0 && rand() % 100 < write_percent);
+}
+
+// child_process 함수 수정
+// 실행 요청이 올 때까지 futex로 잠들어 있다가, 깨어날 때마다 페이지 요청을 하나 보냄
+void child_process(int p_num) {
+    child_p_num = p_num;
+    struct ChildControl* control = &child_controls[p_num];
+    unsigned int handled_seq = 0;   // 마지막으로 처리한 실행 요청 번호
+    
+    struct msg_buffer message;
+    // fork 시점에는 부모가 아직 processes[p_num]을 채우기 전이므로 자식이 직접 초기화
+    processes[p_num].next_page = first_page_request();
+    
+    printf("Child process %d started, waiting for dispatch...\n", getpid());
+    
+    while(1) {
+        unsigned int seq = atomic_load_explicit(&control->dispatch_seq, memory_order_acquire);
+        if(seq == handled_seq) {
+            wait_for_change(&control->dispatch_seq, seq);
+            continue;
+        }
+        handled_seq = seq;
+
+        if(atomic_load_explicit(&control->running, memory_order_relaxed)) {
+            TRACE_VERBOSE("Process %d woken up: Changed to RUNNING state\n", getpid());
+            generate_page_request(child_p_num, &message);
+            
+            if(transport == TRANSPORT_RING) {
+                ring_push(&request_rings[child_p_num], &message);
+            } else {
+                while(1) {
+                    if(msgsnd(msgid, &message, sizeof(message) - sizeof(long), 0) == -1) {
+                        if(errno == EINTR) continue;
+                        perror("msgsnd failed");
+                        exit(1);
+                    }
+                    break;
+                }
+            }
+            notify_parent();
+            
+            TRACE_VERBOSE("Process %d requested page %d with offset 0x%x\n", 
+                   child_p_num, message.page_number, message.offset);
+        }
+    }
+}
+
+// 다음 페이지 요청을 가져오는 함수 (요청이 있으면 1, 없으면 0 반환)
+// fork 모드: 메시지 큐에서 수신, headless 모드: 실행중인 프로세스의 요청을 바로 생성
+int receive_page_request(struct msg_buffer* message) {
+    if(headless_mode) {
+        if(running_queue.size == 0) return 0;
+        struct Process* current = queue_front(&running_queue);
+        if(!current->is_running || current->request_sent) return 0;
+        generate_page_request(current->p_num, message);
+        current->request_sent = 1;
+        return 1;
+    }
+    return msgrcv(msgid, message, sizeof(*message) - sizeof(long), 1, IPC_NOWAIT) != -1;
+}
+
+// 받은 페이지 요청 하나를 처리하는 함수 (페이지 테이블 확인, 폴트 처리, LRU 교체)
+void serve_page_request(const struct msg_buffer* message) {
+    static int last_snapshot_tick = 0;
+
+    int proc_num = message->process_num;
+    int page_num = message->page_number;
+    int offset = message->offset;
+    int write = message->write;
+
+    stats.total_memory_accesses++; // 전체 메모리 접근 횟수 증가
+    if(write) {
+        stats.total_writes++;
+    }
+    reference_index++;
+    if(belady_enabled) {
+        record_reference(proc_num, page_num);  // 종료 시 Belady OPT 기준치 계산용
+    }
+    if(mrc_enabled) {
+        mrc_access(proc_num, page_num);  // LRU 엔진과 같은 요청 순서로 스택 거리 계산
+    }
+    
+    // 메모리 접근 시도 로깅
+    log_memory_access(tick_count, proc_num, page_num, offset, write, -1, EVENT_STATUS_ATTEMPTED);
+
+    // TLB 히트면 페이지 테이블을 보지 않고 바로 프레임을 얻고, 미스면 페이지 테이블을 조회해 TLB에 적재
+    int frame_num = tlb_lookup(proc_num, page_num);
+    if(frame_num == -1) {
+        frame_num = page_table_walk(proc_num, page_num);
+        if(frame_num != -1) {
+            tlb_insert(proc_num, page_num, frame_num);
+        }
+    }
+
+    // 페이지 히트
+    if(frame_num != -1) {
+         TRACE_KERNEL("Page Hit!! \n");
+        policy->on_hit(frame_num);
+        if(write) {
+            pmem.frames[frame_num].dirty = 1;
+        }
+        
+        stats.total_page_hits++; // 페이지 히트 수 증가
+        stats.page_hits_per_process[proc_num]++; // 프로세스별 히트 수 증가
+        
+        log_memory_access(tick_count, proc_num, page_num, offset, write,
+                        frame_num, EVENT_STATUS_HIT);
+        return;
+    }
+
+    // 페이지 폴트
+    TRACE_KERNEL("Page Fault!! \n");
+    stats.total_page_faults++; // 페이지 폴트 수 증가
+    stats.page_faults_per_process[proc_num]++; // 프로세스별 폴트 수 증가
+    log_page_fault(tick_count, proc_num, page_num);
+
+    int key = PAGE_KEY(proc_num, page_num);  // page_table 인덱스
+    if(policy->on_fault != NULL) {
+        policy->on_fault(key);
+    }
+
+    int write_back = 0;
+
+    // 빈 프레임이 있는 경우
+    if(pmem.free_frame_count > 0) {
+        int free_frame = frame_alloc();
+
+        pmem.frames[free_frame].page.pid = proc_num;
+        pmem.frames[free_frame].page.pagenum = page_num;
+        pmem.frames[free_frame].dirty = write;
+        pmem.last_access_time[free_frame] = tick_count;
+        policy->on_load(free_frame, key);
+
+        page_table_map(proc_num, page_num, free_frame);
+        tlb_insert(proc_num, page_num, free_frame);
+
+        log_page_table_update(tick_count, proc_num, page_num, free_frame);
+        log_memory_access(tick_count, proc_num, page_num, offset, write,
+                        free_frame, EVENT_STATUS_LOADED);
+    } else {
+        // 교체할 프레임은 정책이 선택
+        // (LRU: 리스트 tail, CLOCK: 시계 바늘, ARC: T1/T2의 LRU, OPT: 다음 사용이 가장 먼 프레임)
+        // -C이면 write-back이 필요 없는 clean 프레임을 우선
+        TRACE_KERNEL("DO: %s page replacement \n", policy->name);
+        int lru_frame = clean_first ? policy->choose_clean_victim(key) : policy->choose_victim(key);
+        if(policy->on_evict != NULL) {
+            policy->on_evict(lru_frame);
+        }
+
+        int evict_pid = pmem.frames[lru_frame].page.pid;
+        int evict_pagenum = pmem.frames[lru_frame].page.pagenum;
+        write_back = pmem.frames[lru_frame].dirty;
+
+        stats.total_page_replacements++; // 페이지 교체 수 증가
+        if(write_back) {
+            // dirty 페이지는 backing store에 써야 프레임을 재사용할 수 있음
+            stats.total_write_backs++;
+            stats.write_backs_per_process[evict_pid]++;
+        }
+        
+        log_page_replacement(tick_count, evict_pid, evict_pagenum, 
+                           proc_num, page_num, lru_frame, write_back);
+
+        page_table_unmap(evict_pid, evict_pagenum);
+        tlb_invalidate(evict_pid, evict_pagenum);
+
+        pmem.frames[lru_frame].page.pid = proc_num;
+        pmem.frames[lru_frame].page.pagenum = page_num;
+        pmem.frames[lru_frame].dirty = write;
+        pmem.last_access_time[lru_frame] = tick_count;
+        policy->on_load(lru_frame, key);
+
+        page_table_map(proc_num, page_num, lru_frame);
+        tlb_insert(proc_num, page_num, lru_frame);
+
+        log_memory_access(tick_count, proc_num, page_num, offset, write,
+                        lru_frame, EVENT_STATUS_REPLACED);
+    }
+
+    // 스왑 장치 모델이 있으면 폴트를 낸 프로세스는 page-in이 끝날 때까지 대기 (트레이스 재생은 스케줄러가 없음)
+    if(swap_device.enabled) {
+        long ready_tick = swap_page_in(write_back);
+        if(replay_path == NULL) {
+            move_to_page_in_wait(&processes[proc_num], ready_tick);
+        }
+    }
+
+    // 100 틱마다 메모리 스냅샷과 통계 출력
+    if(tick_count - last_snapshot_tick >= 100) {
+        log_memory_snapshot();
+        log_statistics(tick_count);
+        last_snapshot_tick = tick_count;
+    }
+}
+
+// 받은 요청을 트레이스에 기록하고 serve_page_request()로 넘기는 함수
+void accept_page_request(const struct msg_buffer* message) {
+    // 트레이스 기록 중이면 받은 요청을 그대로 파일에 남김
+    if(trace_recording) {
+        trace_write(&trace_writer, tick_count, message->process_num,
+                    message->page_number, message->offset,
+                    message->write ? TRACE_FLAG_WRITE : 0);
+    }
+    serve_page_request(message);
+}
+
+// 모든 자식의 링 버퍼에 쌓인 요청을 한꺼번에 처리하는 함수
+// 링마다 tail을 한 번 읽고 head를 한 번 갱신하므로 요청 수와 관계없이 원자 연산은 링당 2번
+void drain_request_rings() {
+    for(int i = 0; i < num_children; i++) {
+        struct RequestRing* ring = &request_rings[i];
+        unsigned int head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+        if(head == tail) continue;
+        for(; head != tail; head++) {
+            accept_page_request(&ring->slots[head & (RING_SIZE - 1)]);
+        }
+        atomic_store_explicit(&ring->head, head, memory_order_release);
+    }
+}
+
+// 페이지 요청 처리 함수
+// 이번 틱의 요청을 받아 트레이스에 기록하고 serve_page_request()로 넘김
+void handle_page_request() {
+    struct msg_buffer message;
+
+    if(!headless_mode && transport == TRANSPORT_RING) {
+        drain_request_rings();
+        return;
+    }
+    if(receive_page_request(&message)) {
+        accept_page_request(&message);
+    }
+}
+
+void parent_process() {
+    static int current_running_pid = -1;
+    
+    // running queue의 첫 번째 프로세스가 바뀌었는지 확인
+    if(running_queue.size > 0 && queue_front(&running_queue)->pid != current_running_pid) {
+        set_process_running();
+        current_running_pid = queue_front(&running_queue)->pid;
+    }
+
+    if(running_queue.size > 0) {
+        struct Process* current = queue_front(&running_queue);
+        if(tick_count > 0) {
+            stats.cpu_busy_ticks++;
+        }
+         handle_page_request();
+        if(current->io_wait) {
+            // 페이지 폴트로 page-in을 기다리게 됨: 다음 틱에는 다른 프로세스가 실행
+            process_waiting_queue();
+            print_queue_status();
+            return;
+        }
+        if(queue_front(&running_queue)->cpu_burst == 0) {
+            TRACE_KERNEL("\n[KERNEL] Process %d's CPU burst finished. Moving to waiting queue...\n", 
+                   queue_front(&running_queue)->pid);
+            move_to_waiting_queue();
+            process_waiting_queue();
+            print_queue_status();
+            return;
+        }
+
+        decrease_cpu_burst();
+        
+        if(tick_count % TIME_QUANTUM == 0) {
+            TRACE_KERNEL("\n[KERNEL] Time quantum expired. Performing round robin...\n");
+            move_to_back_of_running_queue();
+        }
+    } else {
+        // 실행할 프로세스가 없음 (모두 대기 중): 다시 생기면 같은 프로세스라도 새로 실행시킴
+        current_running_pid = -1;
+    }
+
+    process_waiting_queue();
+    print_queue_status();
+}
+// 한 틱 동안의 스케줄링과 페이지 처리를 수행하는 함수
+void simulate_tick() {
+    tick_count++;
+    TRACE_KERNEL("\nTick %d...\n", tick_count);
+    
+    parent_process();
+    log_tick_boundary();
+}
+// 알람 핸들러 함수
+void alarm_handler(int signo) {
+    simulate_tick();
+}
+
+// 단조 시계 기준 현재 시각 (초)
+double monotonic_seconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// 달성한 초당 틱 수 출력 (빌드/옵션 간 처리량 비교용)
+void print_tick_rate() {
+    if(run_elapsed > 0) {
+        printf("Achieved tick rate: %.0f ticks/sec (%d ticks in %.3f s)\n",
+               tick_count / run_elapsed, tick_count, run_elapsed);
+    }
+}
+
+#ifdef __linux__
+// 도착해 있는 자식 요청을 모두 처리하는 함수 (eventfd 알림을 받았을 때)
+void serve_pending_requests() {
+    struct msg_buffer message;
+
+    if(transport == TRANSPORT_RING) {
+        drain_request_rings();
+        return;
+    }
+    while(receive_page_request(&message)) {
+        accept_page_request(&message);
+    }
+}
+
+// 시뮬레이션 시작 이후 경과 시간 (마이크로초)
+long elapsed_us(const struct timespec* start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1000000L + (now.tv_nsec - start->tv_nsec) / 1000;
+}
+
+// fork 모드 메인 루프: timerfd(틱), eventfd(자식 요청), signalfd(SIGCHLD/SIGINT/SIGTERM)를 epoll로 기다림
+// 틱 처리는 시그널 핸들러가 아닌 일반 문맥에서 실행되고, 밀린 만료는 버리지 않고 모두 따라잡음
+// SIGCHLD/SIGINT/SIGTERM은 fork 전에 main에서 막아 둠
+void run_event_loop() {
+    int epfd, tfd, sfd;
+    int stop = 0;
+    sigset_t mask;
+    struct itimerspec period;
+    struct epoll_event ev;
+    struct epoll_event events[3];
+    struct timespec start;
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGCHLD);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    sfd = signalfd(-1, &mask, SFD_CLOEXEC);
+    tfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    if(sfd == -1 || tfd == -1 || epfd == -1) {
+        perror("event loop setup failed");
+        exit(1);
+    }
+
+    int fds[3] = { tfd, sfd, request_eventfd };
+    for(int i = 0; i < 3; i++) {
+        ev.events = EPOLLIN;
+        ev.data.fd = fds[i];
+        if(epoll_ctl(epfd, EPOLL_CTL_ADD, fds[i], &ev) == -1) {
+            perror("epoll_ctl failed");
+            exit(1);
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if(tick_period_us > 0) {
+        period.it_interval.tv_sec = tick_period_us / 1000000;
+        period.it_interval.tv_nsec = (tick_period_us % 1000000) * 1000L;
+        period.it_value = period.it_interval;
+        if(timerfd_settime(tfd, 0, &period, NULL) == -1) {
+            perror("timerfd_settime");
+            exit(1);
+        }
+    }
+
+    while(tick_count < sim_ticks && !stop) {
+        // 속도 제한이 없으면 기다리지 않고 도착한 이벤트만 확인
+        int n = epoll_wait(epfd, events, 3, tick_period_us > 0 ? -1 : 0);
+        if(n == -1) {
+            if(errno == EINTR) continue;
+            perror("epoll_wait failed");
+            exit(1);
+        }
+
+        for(int i = 0; i < n; i++) {
+            int fd = events[i].data.fd;
+
+            if(fd == tfd) {
+                uint64_t expirations;
+                if(read(tfd, &expirations, sizeof(expirations)) != sizeof(expirations)) continue;
+                tick_stats.timer_reads++;
+                tick_stats.overruns += expirations - 1;
+
+                for(; expirations > 0 && tick_count < sim_ticks; expirations--) {
+                    // 이번 틱(tick_count + 1)의 예정 시각 대비 지연
+                    long lag = elapsed_us(&start) - (long)(tick_count + 1) * tick_period_us;
+                    if(lag >= tick_period_us) tick_stats.late_ticks++;
+                    if(lag > tick_stats.max_lag_us) tick_stats.max_lag_us = lag;
+                    simulate_tick();
+                }
+            } else if(fd == request_eventfd) {
+                eventfd_t count;
+                eventfd_read(request_eventfd, &count);
+                tick_stats.request_wakeups++;
+                serve_pending_requests();
+            } else if(fd == sfd) {
+                struct signalfd_siginfo info;
+                if(read(sfd, &info, sizeof(info)) != sizeof(info)) continue;
+                if(info.ssi_signo == SIGCHLD) {
+                    // 자식이 멈추거나(CLD_STOPPED) 다시 실행될 때(CLD_CONTINUED)도 SIGCHLD가 오므로 실제 종료만 처리
+                    if(info.ssi_code != CLD_EXITED && info.ssi_code != CLD_KILLED && info.ssi_code != CLD_DUMPED) continue;
+                    fprintf(stderr, "Child process %d exited unexpectedly\n", info.ssi_pid);
+                } else {
+                    fprintf(stderr, "Interrupted by signal %d\n", info.ssi_signo);
+                }
+                stop = 1;
+            }
+        }
+
+        // 속도 제한 없음: 이전 틱의 처리가 끝나면 바로 다음 틱 실행
+        if(tick_period_us == 0 && !stop && tick_count < sim_ticks) {
+            simulate_tick();
+        }
+    }
+
+    close(epfd);
+    close(tfd);
+    close(sfd);
+
+    if(tick_period_us > 0) {
+        printf("Timer reads: %ld, overruns: %ld, late ticks: %ld, max lag: %ld us\n",
+               tick_stats.timer_reads, tick_stats.overruns, tick_stats.late_ticks, tick_stats.max_lag_us);
+    }
+}
+#endif
+
+// headless 모드 실행: 자식 프로세스 없이 프로세스 정보만 만들고 타이머 없이 틱을 연속 실행
+void run_headless() {
+    for(int i = 0; i < num_children; i++) {
+        init_process_info(i, i);  // 실제 pid가 없으므로 프로세스 번호를 pid로 사용
+        register_process_pages(i);
+        add_to_running_queue(&processes[i]);
+    }
+
+    parent_process();
+
+    printf("\nRunning headless simulation for %d ticks...\n", sim_ticks);
+    while(tick_count < sim_ticks) {
+        simulate_tick();
+    }
+    printf("\n=== Simulation completed at tick %d ===\n", tick_count);
+}
+
+// 트레이스 재생 실행: 기록된 요청을 순서대로 serve_page_request()에 넣음
+// 스케줄링 결과는 이미 트레이스에 반영되어 있으므로 스케줄러는 거치지 않음
+void run_replay(const char* path) {
+    struct TraceMap map;
+    struct msg_buffer message;
+
+    trace_map_open(&map, path);
+    // 기록할 때와 규모가 다르면 같은 키가 다른 페이지를 가리키므로 재생하지 않음
+    if(map.num_children != num_children || map.pages_per_process != pages_per_process) {
+        fprintf(stderr, "Trace was recorded with -p %d -v %d, but running with -p %d -v %d\n",
+                map.num_children, map.pages_per_process, num_children, pages_per_process);
+        exit(1);
+    }
+    // 정책이나 페이지 테이블이 레코드를 보기 전에 모든 레코드의 범위를 한 번에 검사
+    for(long i = 0; i < map.count; i++) {
+        const struct TraceRecord* record = &map.records[i];
+        if(record->process_num < 0 || record->process_num >= num_children ||
+           record->page_number < 0 || record->page_number >= pages_per_process) {
+            fprintf(stderr, "Trace record %ld out of range (P%d, page %d)\n",
+                    i, record->process_num, record->page_number);
+            exit(1);
+        }
+    }
+    for(int i = 0; i < num_children; i++) {
+        register_process_pages(i);
+    }
+    // 재생할 전체 요청 순서를 미리 알 수 있으므로 정책에 전달 (OPT의 다음 사용 위치 계산)
+    if(policy->prepare != NULL) {
+        policy->prepare(map.records, map.count);
+    }
+
+    printf("\nReplaying %ld references from %s...\n", map.count, path);
+    message.msg_type = 1;
+    for(long i = 0; i < map.count; i++) {
+        const struct TraceRecord* record = &map.records[i];
+        tick_count = record->tick;
+        message.process_num = record->process_num;
+        message.page_number = record->page_number;
+        message.offset = record->offset;
+        message.write = (record->flags & TRACE_FLAG_WRITE) != 0;
+        tlb_switch(record->process_num);    // 요청한 프로세스가 바뀌면 문맥 교환으로 봄
+        serve_page_request(&message);
+        // 재생 중에는 바뀐 틱마다를 틱 경계로 보고 로그를 비움
+        if(i + 1 == map.count || map.records[i + 1].tick != record->tick) {
+            log_tick_boundary();
+        }
+    }
+    printf("\n=== Replay completed at tick %d ===\n", tick_count);
+    trace_map_close(&map);
+}
+
+// 시뮬레이션 종료 후 트레이스 파일을 닫고 분석 결과(miss-ratio curve, Belady 기준치)를 계산
+void finish_analysis() {
+    trace_writer_close(&trace_writer);
+    if(mrc_enabled) {
+        mrc_write_curve(mrc_path);
+    }
+    if(belady_enabled) {
+        printf("\nRunning Belady OPT over %ld recorded references...\n", ref_count);
+        run_belady_opt(ref_seq, ref_count, total_frames);
+        free(ref_seq);
+    }
+}
+
+// 옵션으로 정한 규모에 맞춰 프로세스/프레임/페이지 테이블 배열을 할당하는 함수
+// 각 배열은 캐시 라인에 맞춘 연속 메모리 하나이므로 page_table은 평면 배열 그대로 인덱싱됨
+void init_simulation_arrays() {
+    total_pages = num_children * pages_per_process;
+    processes = alloc_aligned(num_children, sizeof(struct Process));
+    stats.page_faults_per_process = alloc_aligned(num_children, sizeof(int));
+    stats.page_hits_per_process = alloc_aligned(num_children, sizeof(int));
+    stats.write_backs_per_process = alloc_aligned(num_children, sizeof(int));
+    queue_init(&running_queue, num_children);
+    pmem.frames = alloc_aligned(total_frames, sizeof(struct Frame));
+    pmem.last_access_time = alloc_aligned(total_frames, sizeof(int));
+    pmem.age = alloc_aligned(total_frames, sizeof(int));
+    pmem.free_map_words = (total_frames + 63) / 64;
+    pmem.free_map = alloc_aligned(pmem.free_map_words, sizeof(uint64_t));
+    virtual_memory.pages = alloc_aligned(total_pages, sizeof(struct Page));
+}
+
+void print_usage(const char* prog) {
+    fprintf(stderr, "Usage: %s [-H] [-n ticks] [-t usec] [-p procs] [-v pages] [-f frames] [-X bursts] [-b tlb] [-g table] [-A bits] [-S swap] [-P policy] [-w workload] [-W percent] [-C] [-r trace] [-R trace] [-T ring|msg] [-m curve] [-B] [-L block|drop] [-E events]\n", prog);
+    fprintf(stderr, "  -H        headless mode (no fork, signals or message queue)\n");
+    fprintf(stderr, "  -n ticks  number of ticks to simulate (default %d)\n", DEFAULT_SIM_TICKS);
+    fprintf(stderr, "  -t usec   tick period in fork mode (default %d, 0 = unthrottled)\n", DEFAULT_TICK_PERIOD_US);
+    fprintf(stderr, "  -p procs  number of simulated processes (default %d, fork mode up to %d)\n",
+            DEFAULT_NUM_CHILDREN, FORK_MAX_CHILDREN);
+    fprintf(stderr, "  -v pages  virtual pages per process (default %d)\n", DEFAULT_PAGES_PER_PROCESS);
+    fprintf(stderr, "  -f frames number of physical frames (default %d)\n", DEFAULT_TOTAL_FRAMES);
+    fprintf(stderr, "  -X bursts a process exits and frees its frames after this many CPU bursts, then restarts (default 0 = never)\n");
+    fprintf(stderr, "  -b entries[,ways[,lru|fifo|random[,asid|flush]]]  TLB model (default %d,%d,lru,asid; 0 = no TLB, ways 0 = fully associative)\n",
+            DEFAULT_TLB_ENTRIES, DEFAULT_TLB_WAYS);
+    fprintf(stderr, "  -g dense|radix2|radix4|hashed  page table backend (default dense)\n");
+    fprintf(stderr, "  -A bits   scatter each process's pages over a bits-wide virtual address space (%d..%d, default: pages 0..v-1)\n",
+            OFFSET_BITS + 1, MAX_ADDRESS_BITS);
+    fprintf(stderr, "  -S read[,write[,depth]]  swap device latency in ticks and queue depth; a faulting process waits for its page-in (default off, write = read, depth %d)\n",
+            DEFAULT_SWAP_QUEUE_DEPTH);
+    fprintf(stderr, "  -r trace  record every page request to a binary trace file\n");
+    fprintf(stderr, "  -R trace  replay a binary trace instead of generating requests\n");
+    fprintf(stderr, "  -T ring|msg  request transport in fork mode (default ring)\n");
+    fprintf(stderr, "  -P lru|clock|arc|opt|aging  page replacement policy (default lru, opt requires -R)\n");
+    fprintf(stderr, "  -w random|sequential  page request pattern (default random)\n");
+    fprintf(stderr, "  -W percent share of requests that are writes (default 0)\n");
+    fprintf(stderr, "  -C        prefer clean frames when choosing a victim (lru, clock, aging)\n");
+    fprintf(stderr, "  -m curve  write the LRU miss-ratio curve for 1..(processes * pages) frames\n");
+    fprintf(stderr, "  -B        also report Belady OPT on the same reference string\n");
+    fprintf(stderr, "  -L block|drop  when the log buffer fills: flush immediately or drop lines (default block)\n");
+    fprintf(stderr, "  -E events write a compact binary event log instead of the text log (render with event_decode)\n");
+}
+/*--------------------------------------------------------------------------------- */
+
+int main(int argc, char* argv[]) {
+    pid_t pid;
+    pid_t* child_pids = NULL;
+    time_t start_time = time(NULL);
+    int opt;
+
+    policy = &policies[POLICY_LRU];
+    page_table_backend = &page_tables[PT_DENSE];
+
+    // 실행 옵션 처리
+    while((opt = getopt(argc, argv, "Hn:t:p:v:f:X:b:g:A:S:r:R:T:m:P:w:W:CBL:E:")) != -1) {
+        switch(opt) {
+        case 'H':
+            headless_mode = 1;
+            break;
+        case 'n':
+            sim_ticks = atoi(optarg);
+            if(sim_ticks <= 0) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 't':
+            tick_period_us = atol(optarg);
+            if(tick_period_us < 0) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'p':
+            num_children = atoi(optarg);
+            if(num_children <= 0) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'v':
+            pages_per_process = atoi(optarg);
+            if(pages_per_process <= 0) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'f':
+            total_frames = atoi(optarg);
+            if(total_frames <= 0) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'X':
+            process_lifetime = atoi(optarg);
+            if(process_lifetime < 0) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'b':
+            if(parse_tlb_spec(optarg) != 0) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'g':
+            page_table_backend = find_page_table(optarg);
+            if(page_table_backend == NULL) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'A':
+            address_bits = atoi(optarg);
+            if(address_bits <= OFFSET_BITS || address_bits > MAX_ADDRESS_BITS) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'S':
+            if(parse_swap_spec(optarg) != 0) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'r':
+            record_path = optarg;
+            break;
+        case 'R':
+            replay_path = optarg;
+            break;
+        case 'P':
+            policy = find_policy(optarg);
+            if(policy == NULL) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'w':
+            if(strcmp(optarg, "random") == 0) {
+                workload = WORKLOAD_RANDOM;
+            } else if(strcmp(optarg, "sequential") == 0) {
+                workload = WORKLOAD_SEQUENTIAL;
+            } else {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'W':
+            write_percent = atoi(optarg);
+            if(write_percent < 0 || write_percent > 100) {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'C':
+            clean_first = 1;
+            break;
+        case 'B':
+            belady_enabled = 1;
+            break;
+        case 'L':
+            if(strcmp(optarg, "block") == 0) {
+                log_buffer.full_mode = LOG_FULL_BLOCK;
+            } else if(strcmp(optarg, "drop") == 0) {
+                log_buffer.full_mode = LOG_FULL_DROP;
+            } else {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        case 'E':
+            event_log_path = optarg;
+            event_log_enabled = 1;
+            break;
+        case 'm':
+            mrc_path = optarg;
+            mrc_enabled = 1;
+            break;
+        case 'T':
+            if(strcmp(optarg, "ring") == 0) {
+                transport = TRANSPORT_RING;
+            } else if(strcmp(optarg, "msg") == 0) {
+                transport = TRANSPORT_MSG;
+            } else {
+                print_usage(argv[0]);
+                exit(1);
+            }
+            break;
+        default:
+            print_usage(argv[0]);
+            exit(1);
+        }
+    }
+
+
+    // 재생은 기록 경로를 거치지 않으므로 같이 쓰면 빈 트레이스만 남음
+    if(record_path != NULL && replay_path != NULL) {
+        fprintf(stderr, "-r cannot be combined with -R: the replayed trace already holds the reference string\n");
+        exit(1);
+    }
+    // OPT처럼 미래 요청 순서가 필요한 정책은 트레이스 재생에서만 사용 가능
+    if(policy->prepare != NULL && replay_path == NULL) {
+        fprintf(stderr, "%s needs the full reference string: record with -r, then replay with -R\n",
+                policy->name);
+        exit(1);
+    }
+    if(clean_first && policy->choose_clean_victim == NULL) {
+        fprintf(stderr, "%s has no clean-first victim selection (-C works with lru, clock and aging)\n",
+                policy->name);
+        exit(1);
+    }
+    // 실제 프로세스를 fork하는 모드는 데모용이므로 규모를 제한
+    if(!headless_mode && replay_path == NULL && num_children > FORK_MAX_CHILDREN) {
+        fprintf(stderr, "fork mode supports at most %d processes (requested %d): use -H\n",
+                FORK_MAX_CHILDREN, num_children);
+        exit(1);
+    }
+    // 페이지 키(PAGE_KEY)와 total_pages는 int이므로 전체 페이지 수가 넘치면 서로 다른 페이지가 같은 키가 됨
+    if((long)num_children * pages_per_process > INT_MAX) {
+        fprintf(stderr, "%d processes x %d pages exceeds %d total pages\n",
+                num_children, pages_per_process, INT_MAX);
+        exit(1);
+    }
+    // Fenwick tree 시간 축(전체 페이지 수의 2배 이상, 2의 거듭제곱)도 int에 들어가야 함
+    if(mrc_enabled && (long)num_children * pages_per_process > MRC_MAX_PAGES) {
+        fprintf(stderr, "-m supports at most %d total pages\n", MRC_MAX_PAGES);
+        exit(1);
+    }
+    // 흩어 놓을 주소 공간에 프로세스의 페이지가 모두 들어가야 함
+    if(address_bits > 0 && pages_per_process > (1L << (address_bits - OFFSET_BITS))) {
+        fprintf(stderr, "%d pages per process do not fit in a %d-bit address space\n",
+                pages_per_process, address_bits);
+        exit(1);
+    }
+    if(record_path != NULL) {
+        trace_writer_open(&trace_writer, record_path, num_children, pages_per_process);
+        trace_recording = 1;
+    }
+    init_simulation_arrays();
+    init_tlb();
+    init_swap_device();
+    if(mrc_enabled) {
+        mrc_init();
+    }
+    if(policy->init != NULL) {
+        policy->init();
+    }
+    
+    // 난수 생성기 초기화
+    srand(time(NULL));
+    
+    // 각종 초기화
+    init_virtual_memory();
+    init_physical_memory();
+    init_page_table();
+    init_logging();
+
+    if(headless_mode || replay_path != NULL) {
+        double run_start = monotonic_seconds();
+        if(replay_path != NULL) {
+            run_replay(replay_path);
+        } else {
+            run_headless();
+        }
+        run_elapsed = monotonic_seconds() - run_start;
+        printf("Total simulation time: %ld seconds\n", time(NULL) - start_time);
+        print_tick_rate();
+        finish_analysis();
+        printf("\nWriting final statistics to log file...\n");
+        close_logging();
+        printf("\n=== Simulation Ended Successfully ===\n");
+        return 0;
+    }
+
+    if(transport == TRANSPORT_RING) {
+        init_request_rings();
+    } else {
+        init_msg_queue();
+    }
+    init_child_controls();
+    child_pids = malloc(sizeof(pid_t) * num_children);
+    if(child_pids == NULL) {
+        perror("malloc failed");
+        exit(1);
+    }
+
+#ifdef __linux__
+    // 이벤트 루프가 signalfd로 받도록 fork 전에 막아 둠 (자식은 원래 마스크로 되돌림)
+    sigset_t loop_signals, old_signals;
+    sigemptyset(&loop_signals);
+    sigaddset(&loop_signals, SIGCHLD);
+    sigaddset(&loop_signals, SIGINT);
+    sigaddset(&loop_signals, SIGTERM);
+    sigprocmask(SIG_BLOCK, &loop_signals, &old_signals);
+
+    request_eventfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if(request_eventfd == -1) {
+        perror("eventfd failed");
+        exit(1);
+    }
+#else
+    // 타이머 설정
+    struct itimerval timer;
+    timer.it_value.tv_sec = tick_period_us / 1000000;
+    timer.it_value.tv_usec = tick_period_us % 1000000;
+    timer.it_interval = timer.it_value;
+
+    // SIGALRM 핸들러 등록
+    signal(SIGALRM, alarm_handler);
+#endif
+
+    printf("\n=== Starting Virtual Memory Management Simulation ===\n");
+    printf("Total Pages: %d, Total Frames: %d\n", total_pages, total_frames);
+    printf("Page Size: %d bytes\n", PAGE_SIZE);
+    printf("Physical Memory Size: %d bytes\n\n", FRAME_SIZE * total_frames);
+
+    // 자식 프로세스 생성
+    for(int i = 0; i < num_children; i++) {
+        pid = fork();
+        
+        if(pid < 0) {
+            fprintf(stderr, "Fork failed for process %d\n", i);
+            exit(1);
+        }
+        else if(pid == 0) {
+#ifdef __linux__
+            sigprocmask(SIG_SETMASK, &old_signals, NULL);
+#endif
+            child_process(i);
+            exit(0);
+        }
+        else {
+            child_pids[i] = pid;
+            init_process_info(pid, i);
+            register_process_pages(i);
+            add_to_running_queue(&processes[i]); 
+            printf("Created child process %d with PID: %d\n", i + 1, pid);
+        }
+    }
+
+    // 첫 번째 프로세스 실행
+    parent_process();
+    
+    if(tick_period_us > 0) {
+        printf("\nTimer started (%ld us per tick). Running simulation for %d ticks...\n",
+               tick_period_us, sim_ticks);
+    } else {
+        printf("\nRunning simulation unthrottled for %d ticks...\n", sim_ticks);
+    }
+    double run_start = monotonic_seconds();
+
+#ifdef __linux__
+    run_event_loop();
+#else
+    if(tick_period_us == 0) {
+        // 속도 제한 없음: 타이머 없이 연속 실행
+        while(tick_count < sim_ticks) {
+            simulate_tick();
+        }
+    } else {
+        // 타이머 시작
+        if (setitimer(ITIMER_REAL, &timer, NULL) == -1) {
+            perror("setitimer");
+            exit(1);
+        }
+        
+        // sim_ticks 틱까지 실행
+        while(tick_count < sim_ticks) {
+            pause();
+        }
+
+        // 타이머 중지
+        struct itimerval stop_timer = {0};
+        setitimer(ITIMER_REAL, &stop_timer, NULL);
+    }
+#endif
+    run_elapsed = monotonic_seconds() - run_start;
+
+    printf("\n=== Simulation completed at tick %d ===\n", tick_count);
+    time_t end_time = time(NULL);
+    printf("Total simulation time: %ld seconds\n", end_time - start_time);
+    print_tick_rate();
+
+    // 자식 프로세스들 종료
+    printf("\nTerminating child processes...\n");
+    for(int i = 0; i < num_children; i++) {
+        kill(child_pids[i], SIGTERM);
+    }
+
+    // 자식 프로세스들이 완전히 종료될 때까지 대기
+    for(int i = 0; i < num_children; i++) {
+        waitpid(child_pids[i], NULL, 0);
+        printf("Child process %d terminated\n", child_pids[i]);
+    }
+
+    munmap(child_controls, sizeof(struct ChildControl) * num_children);
+
+    // 메시지 큐 / 링 버퍼 제거
+    if(transport == TRANSPORT_RING) {
+        munmap(request_rings, sizeof(struct RequestRing) * num_children);
+        printf("Request rings removed successfully\n");
+    } else if (msgctl(msgid, IPC_RMID, NULL) == -1) {
+        perror("Failed to remove message queue");
+    } else {
+        printf("Message queue removed successfully\n");
+    }
+
+    finish_analysis();
+
+    // 최종 통계 출력 및 로그 파일 닫기
+    printf("\nWriting final statistics to log file...\n");
+    close_logging();
+    
+    printf("\n=== Simulation Ended Successfully ===\n");
+    return 0;
+}
\ No newline at end of file
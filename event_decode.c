@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "event_log.h"
+
+// 바이너리 이벤트 로그(-E)를 읽어서 시뮬레이터의 텍스트 로그 형식으로 출력하는 도구
+// 사용법: event_decode events.bin [output.txt]   (출력 파일을 생략하면 표준 출력)
+
+#define SEPARATOR "------------------------------------------------------\n"
+
+FILE* in;
+FILE* out;
+struct EventLogHeader header;
+
+// 본문 하나를 읽는 함수 (잘린 파일이면 0)
+int read_payload(void* payload, int size) {
+    return fread(payload, 1, size, in) == (size_t)size;
+}
+
+void print_memory_access(const struct EventMemoryAccess* ev) {
+    fprintf(out, "[Tick %d] Memory Access\n", ev->tick);
+    fprintf(out, "Process: P%d\n", ev->process_num);
+    fprintf(out, "Virtual Address: Page %d, Offset 0x%x\n", ev->page_num, ev->offset);
+    if(ev->write) {
+        fprintf(out, "Access: Write\n");
+    }
+    if(ev->frame_num != -1) {
+        fprintf(out, "Physical Address: Frame %d, Offset 0x%x\n", ev->frame_num, ev->offset);
+    }
+    if(ev->status >= 0 && ev->status <= EVENT_STATUS_REPLACED) {
+        fprintf(out, "Status: %s\n", event_status_text[ev->status]);
+    } else {
+        fprintf(out, "Status: Unknown (%d)\n", ev->status);
+    }
+    fprintf(out, SEPARATOR);
+}
+
+void print_page_fault(const struct EventPageFault* ev) {
+    fprintf(out, "[Tick %d] PAGE FAULT\n", ev->tick);
+    fprintf(out, "Process: P%d\n", ev->process_num);
+    fprintf(out, "Faulting Page: %d\n", ev->page_num);
+    fprintf(out, SEPARATOR);
+}
+
+void print_page_table_update(const struct EventPageTableUpdate* ev) {
+    fprintf(out, "[Tick %d] Page Table Update\n", ev->tick);
+    fprintf(out, "Process: P%d\n", ev->process_num);
+    fprintf(out, "Page Number: %d\n", ev->page_num);
+    fprintf(out, "New Frame: %d\n", ev->new_frame);
+    fprintf(out, SEPARATOR);
+}
+
+void print_page_replacement(const struct EventPageReplacement* ev) {
+    fprintf(out, "[Tick %d] %s Page Replacement\n", ev->tick, header.policy);
+    fprintf(out, "Evicted Process: P%d, Page: %d\n", ev->evicted_pid, ev->evicted_page);
+    fprintf(out, "New Process: P%d, Page: %d\n", ev->new_pid, ev->new_page);
+    fprintf(out, "Frame Number: %d\n", ev->frame);
+    if(ev->write_back) {
+        fprintf(out, "Write-back: Dirty page written to backing store\n");
+    }
+    fprintf(out, SEPARATOR);
+}
+
+void print_snapshot_frame(const struct EventSnapshotFrame* ev) {
+    switch(ev->kind) {
+    case EVENT_FRAME_FREE:
+        fprintf(out, "Frame %2d: Free\n", ev->frame);
+        break;
+    case EVENT_FRAME_LAST_ACCESS:
+        fprintf(out, "Frame %2d: Process P%d, Page 0x%x, Last Access: %d\n",
+                ev->frame, ev->pid, ev->page, ev->value);
+        break;
+    default:
+        fprintf(out, "Frame %2d: Process P%d, Page 0x%x, Referenced: %d%s\n",
+                ev->frame, ev->pid, ev->page, ev->value,
+                (ev->kind == EVENT_FRAME_HAND) ? " <- hand" : "");
+        break;
+    }
+}
+
+void print_statistics(const struct EventStatistics* ev) {
+    fprintf(out, "\n=== Statistics at Tick %d ===\n", ev->tick);
+    fprintf(out, "Total Page Faults: %d\n", ev->total_page_faults);
+    fprintf(out, "Total Page Hits: %d\n", ev->total_page_hits);
+    fprintf(out, "Total Page Replacements: %d\n", ev->total_replacements);
+    fprintf(out, "Page Fault Rate: %.2f%%\n",
+            (float)ev->total_page_faults / (ev->total_page_faults + ev->total_page_hits) * 100);
+    fprintf(out, SEPARATOR);
+}
+
+int main(int argc, char* argv[]) {
+    union {
+        struct EventMemoryAccess access;
+        struct EventPageFault fault;
+        struct EventPageTableUpdate update;
+        struct EventPageReplacement replacement;
+        struct EventSnapshotFrame frame;
+        struct EventSnapshotEnd end;
+        struct EventStatistics statistics;
+    } ev;
+    long events = 0;
+    int type;
+
+    if(argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: %s events.bin [output.txt]\n", argv[0]);
+        exit(1);
+    }
+
+    in = fopen(argv[1], "rb");
+    if(in == NULL) {
+        perror("Failed to open event log");
+        exit(1);
+    }
+    setvbuf(in, NULL, _IOFBF, 1 << 20);
+
+    if(fread(&header, sizeof(header), 1, in) != 1 ||
+       memcmp(header.magic, EVENT_LOG_MAGIC, 4) != 0) {
+        fprintf(stderr, "%s: not an event log\n", argv[1]);
+        exit(1);
+    }
+    if(header.version != EVENT_LOG_VERSION) {
+        fprintf(stderr, "%s: unsupported event log version %d\n", argv[1], header.version);
+        exit(1);
+    }
+    header.policy[sizeof(header.policy) - 1] = '\0';
+
+    out = stdout;
+    if(argc == 3) {
+        out = fopen(argv[2], "w");
+        if(out == NULL) {
+            perror("Failed to open output file");
+            exit(1);
+        }
+    }
+    setvbuf(out, NULL, _IOFBF, 1 << 20);
+
+    // 시뮬레이터 텍스트 로그와 같은 헤더
+    fprintf(out, "======================================================\n");
+    fprintf(out, "Virtual Memory Management Simulation Log\n");
+    fprintf(out, "======================================================\n\n");
+
+    while((type = fgetc(in)) != EOF) {
+        int size = event_payload_size(type);
+        if(size < 0) {
+            fprintf(stderr, "%s: unknown event type %d after %ld events\n", argv[1], type, events);
+            exit(1);
+        }
+        if(!read_payload(&ev, size)) {
+            fprintf(stderr, "%s: truncated event after %ld events\n", argv[1], events);
+            break;
+        }
+        events++;
+
+        switch(type) {
+        case EVENT_MEMORY_ACCESS:     print_memory_access(&ev.access); break;
+        case EVENT_PAGE_FAULT:        print_page_fault(&ev.fault); break;
+        case EVENT_PAGE_TABLE_UPDATE: print_page_table_update(&ev.update); break;
+        case EVENT_PAGE_REPLACEMENT:  print_page_replacement(&ev.replacement); break;
+        case EVENT_SNAPSHOT_BEGIN:    fprintf(out, "\n=== Physical Memory Snapshot ===\n"); break;
+        case EVENT_SNAPSHOT_FRAME:    print_snapshot_frame(&ev.frame); break;
+        case EVENT_SNAPSHOT_END:
+            fprintf(out, "Free Frames: %d\n", ev.end.free_frames);
+            fprintf(out, SEPARATOR);
+            break;
+        case EVENT_STATISTICS:        print_statistics(&ev.statistics); break;
+        }
+    }
+
+    fclose(in);
+    if(out != stdout) {
+        fclose(out);
+    }
+    return 0;
+}
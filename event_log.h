@@ -0,0 +1,117 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+// 바이너리 이벤트 로그 포맷
+// 파일 = EventLogHeader 1개 + 이벤트 레코드 N개
+// 레코드 = 이벤트 종류 1바이트 + 종류별 고정 길이 본문 (모두 int32, 호스트 바이트 순서)
+// 사람이 읽는 텍스트 형식은 event_decode로 필요할 때만 만들어 냄
+
+#include <stdint.h>
+
+#define EVENT_LOG_MAGIC "PGEV"
+#define EVENT_LOG_VERSION 2
+
+// 이벤트 종류
+#define EVENT_MEMORY_ACCESS 1
+#define EVENT_PAGE_FAULT 2
+#define EVENT_PAGE_TABLE_UPDATE 3
+#define EVENT_PAGE_REPLACEMENT 4
+#define EVENT_SNAPSHOT_BEGIN 5
+#define EVENT_SNAPSHOT_FRAME 6
+#define EVENT_SNAPSHOT_END 7
+#define EVENT_STATISTICS 8
+
+// 메모리 접근 상태 코드
+#define EVENT_STATUS_ATTEMPTED 0
+#define EVENT_STATUS_HIT 1
+#define EVENT_STATUS_LOADED 2
+#define EVENT_STATUS_REPLACED 3
+
+static const char* const event_status_text[] = {
+    "Memory Access Attempted",
+    "Page Hit - Memory Access Successful",
+    "New Page Loaded Successfully",
+    "Page Replacement Complete",
+};
+
+// 스냅샷 프레임 표시 방식
+#define EVENT_FRAME_FREE 0          // 빈 프레임
+#define EVENT_FRAME_LAST_ACCESS 1   // value = 마지막 접근 틱
+#define EVENT_FRAME_REFERENCED 2    // value = 참조 비트 (CLOCK)
+#define EVENT_FRAME_HAND 3          // value = 참조 비트, 시계 바늘 위치 (CLOCK)
+
+// 이벤트 로그 파일 헤더
+struct EventLogHeader {
+    char magic[4];          // "PGEV"
+    int32_t version;
+    char policy[16];        // 교체 정책 이름 (교체 이벤트 출력에 사용)
+};
+
+struct EventMemoryAccess {
+    int32_t tick;
+    int32_t process_num;
+    int32_t page_num;
+    int32_t offset;
+    int32_t frame_num;      // -1: 아직 물리 주소 없음
+    int32_t status;         // EVENT_STATUS_*
+    int32_t write;          // 1: 쓰기 접근
+};
+
+struct EventPageFault {
+    int32_t tick;
+    int32_t process_num;
+    int32_t page_num;
+};
+
+struct EventPageTableUpdate {
+    int32_t tick;
+    int32_t process_num;
+    int32_t page_num;
+    int32_t new_frame;
+};
+
+struct EventPageReplacement {
+    int32_t tick;
+    int32_t evicted_pid;
+    int32_t evicted_page;
+    int32_t new_pid;
+    int32_t new_page;
+    int32_t frame;
+    int32_t write_back;     // 1: dirty 페이지를 backing store에 씀
+};
+
+struct EventSnapshotFrame {
+    int32_t frame;
+    int32_t kind;           // EVENT_FRAME_*
+    int32_t pid;
+    int32_t page;
+    int32_t value;
+};
+
+struct EventSnapshotEnd {
+    int32_t free_frames;
+};
+
+struct EventStatistics {
+    int32_t tick;
+    int32_t total_page_faults;
+    int32_t total_page_hits;
+    int32_t total_replacements;
+};
+
+// 이벤트 종류별 본문 크기 (0: 본문 없음, -1: 알 수 없는 종류)
+static inline int event_payload_size(int type) {
+    switch(type) {
+    case EVENT_MEMORY_ACCESS:     return sizeof(struct EventMemoryAccess);
+    case EVENT_PAGE_FAULT:        return sizeof(struct EventPageFault);
+    case EVENT_PAGE_TABLE_UPDATE: return sizeof(struct EventPageTableUpdate);
+    case EVENT_PAGE_REPLACEMENT:  return sizeof(struct EventPageReplacement);
+    case EVENT_SNAPSHOT_BEGIN:    return 0;
+    case EVENT_SNAPSHOT_FRAME:    return sizeof(struct EventSnapshotFrame);
+    case EVENT_SNAPSHOT_END:      return sizeof(struct EventSnapshotEnd);
+    case EVENT_STATISTICS:        return sizeof(struct EventStatistics);
+    default:                      return -1;
+    }
+}
+
+#endif
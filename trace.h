@@ -0,0 +1,154 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// 페이지 접근 트레이스 바이너리 포맷
+// 파일 = TraceHeader 1개 + TraceRecord N개 (모두 고정 길이, 호스트 바이트 순서)
+// 같은 트레이스를 여러 교체 정책에 재생해서 동일한 입력으로 비교하기 위해 사용
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define TRACE_MAGIC "PGTR"
+#define TRACE_VERSION 3
+
+#define TRACE_FLAG_WRITE 1      // 쓰기 접근
+
+// 트레이스 파일 헤더
+struct TraceHeader {
+    char magic[4];          // "PGTR"
+    int32_t version;        // 포맷 버전
+    int32_t record_size;    // sizeof(struct TraceRecord)
+    int32_t num_children;       // 기록할 때의 프로세스 수 (-p)
+    int32_t pages_per_process;  // 기록할 때의 프로세스당 페이지 수 (-v)
+};
+
+// 메모리 접근 하나에 대한 기록 (20바이트)
+struct TraceRecord {
+    int32_t tick;           // 요청이 처리된 틱
+    int32_t process_num;    // 프로세스 번호
+    int32_t page_number;    // 페이지 번호
+    int32_t offset;         // 페이지 내 offset
+    int32_t flags;          // TRACE_FLAG_*
+};
+
+// 트레이스 기록기
+struct TraceWriter {
+    FILE* fp;
+    long count;             // 기록한 레코드 수
+};
+
+// 트레이스 재생용 매핑 정보
+struct TraceMap {
+    void* base;                         // mmap 시작 주소
+    size_t length;                      // 매핑한 파일 크기
+    const struct TraceRecord* records;  // 헤더 다음부터 시작하는 레코드 배열
+    long count;                         // 레코드 수
+    int num_children;                   // 헤더에 기록된 프로세스 수
+    int pages_per_process;              // 헤더에 기록된 프로세스당 페이지 수
+};
+
+// 트레이스 파일을 새로 만들고 헤더를 기록하는 함수
+// 재생 시 같은 규모인지 확인할 수 있도록 프로세스 수와 프로세스당 페이지 수를 함께 기록
+static void trace_writer_open(struct TraceWriter* writer, const char* path, int num_children, int pages_per_process) {
+    struct TraceHeader header;
+
+    writer->fp = fopen(path, "wb");
+    if(writer->fp == NULL) {
+        perror("Failed to open trace file");
+        exit(1);
+    }
+    // 레코드를 한 번에 크게 쓰도록 버퍼를 키움
+    setvbuf(writer->fp, NULL, _IOFBF, 1 << 20);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TRACE_MAGIC, 4);
+    header.version = TRACE_VERSION;
+    header.record_size = sizeof(struct TraceRecord);
+    header.num_children = num_children;
+    header.pages_per_process = pages_per_process;
+    if(fwrite(&header, sizeof(header), 1, writer->fp) != 1) {
+        perror("Failed to write trace header");
+        exit(1);
+    }
+    writer->count = 0;
+}
+
+// 레코드 하나를 기록하는 함수
+static void trace_write(struct TraceWriter* writer, int tick, int process_num, int page_number, int offset, int flags) {
+    struct TraceRecord record;
+
+    record.tick = tick;
+    record.process_num = process_num;
+    record.page_number = page_number;
+    record.offset = offset;
+    record.flags = flags;
+    if(fwrite(&record, sizeof(record), 1, writer->fp) != 1) {
+        perror("Failed to write trace record");
+        exit(1);
+    }
+    writer->count++;
+}
+
+static void trace_writer_close(struct TraceWriter* writer) {
+    if(writer->fp != NULL) {
+        fclose(writer->fp);
+        writer->fp = NULL;
+    }
+}
+
+// 트레이스 파일을 mmap으로 열어 레코드 배열로 접근할 수 있게 하는 함수
+// 파일 내용을 힙으로 복사하지 않으므로 큰 트레이스도 페이지 단위로 흘려 읽음
+static void trace_map_open(struct TraceMap* map, const char* path) {
+    struct stat st;
+    const struct TraceHeader* header;
+    int fd = open(path, O_RDONLY);
+
+    if(fd == -1) {
+        perror("Failed to open trace file");
+        exit(1);
+    }
+    if(fstat(fd, &st) == -1) {
+        perror("fstat failed");
+        exit(1);
+    }
+    if((size_t)st.st_size < sizeof(struct TraceHeader)) {
+        fprintf(stderr, "Invalid trace file: %s\n", path);
+        exit(1);
+    }
+
+    map->length = st.st_size;
+    map->base = mmap(NULL, map->length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(map->base == MAP_FAILED) {
+        perror("mmap failed");
+        exit(1);
+    }
+    madvise(map->base, map->length, MADV_SEQUENTIAL);
+
+    header = (const struct TraceHeader*)map->base;
+    if(memcmp(header->magic, TRACE_MAGIC, 4) != 0 || header->version != TRACE_VERSION ||
+       header->record_size != sizeof(struct TraceRecord)) {
+        fprintf(stderr, "Invalid trace file: %s\n", path);
+        exit(1);
+    }
+
+    map->records = (const struct TraceRecord*)((const char*)map->base + sizeof(struct TraceHeader));
+    map->count = (map->length - sizeof(struct TraceHeader)) / sizeof(struct TraceRecord);
+    map->num_children = header->num_children;
+    map->pages_per_process = header->pages_per_process;
+}
+
+static void trace_map_close(struct TraceMap* map) {
+    if(map->base != NULL) {
+        munmap(map->base, map->length);
+        map->base = NULL;
+    }
+}
+
+#endif